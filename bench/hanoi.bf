@@ -0,0 +1,1151 @@
+Towers of Hanoi with 20 disks solved iteratively: a 20 bit counter picks the
+disk to move and every disk cycles over the pegs in a fixed direction
+Prints the moves of the six largest disks followed by the move count and the
+final position of every disk
+
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]++++++++++>[-]++++++++++>[-]++++++
+++++>[-]++++++++++>[-]++++++++++>[-]++++++++++>[-]++++++++++<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]+
+<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>][-]+<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<[-]<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]+<[<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>][-]+<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<[-]<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]+<[<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]+<[<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]+<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<[-
+]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>][-]+<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<[-]<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]+<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<
+[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]+<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
++>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]+<[<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+
+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>][-]+<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<[-]<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]+<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>][-]+<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<[-]<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]+<[<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]+<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
++>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]+<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>][-]+<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]+<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]+<[<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<
+[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++.++.+++++++.-----------------.-------------------------
+--------------------------------------------.+++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++.+++++.++++++++++.--------.----------------
+-----------------------------------------------------------.++++++++++++++++++
+.--.----------------.+++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++.++++++++++++.---.--.--------------------------------------------
+---------------------------------.[-]>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++.[-][-]++++++++++++++++++++++++++++++++.+++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.-----.--
+-----------------------------------------------------------------------------.
+[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>[-]+++>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]<[-]<<[->>+>+<<<]>>>[-<<<+>>
+>]<<[->>>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<->[-]]<<]<<[-]>>>>>[-]<[-]<[->+>+<<]>>[
+-<<+>>]<[<<<<[-]+>>>>[-]]<[-]<<[-]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>][-]+<<[>>
+[-]<<[-]]>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+++>>>
+[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>][-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<[->>[-]<[-]<<[->>+>+<<<]>>>[-
+<<<+>>>]<[<<->>[-]]<]<<<[-]>>>>>[-]<[-]<<[->>+>+<<<]>>>[-<<<+>>>]<[<<<<[-]+>>>
+>[-]]<<[-]<[-]>[-]<[-]<[->+>+<<]>>[-<<+>>][-]+<[>[-]<[-]]>[<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>[-]]<<[-]>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++.[-][-]++++++++++.[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]>[-]]>[-]<[-]<[->+>+<<]>>[-<<+
+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]>[-]]>[-]<[-]<[->+>+<<]>>
+[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>[-]<[-]<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]>[-]]>[-]<[-
+]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++
+++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>[-]<[-]<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>]<[<[-]>[-]]>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>[-]+>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]>[-]]>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]>[-
+]]>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]
+<[-]<[-]]<[-]<[-]]<[-]<[-]]<[-]<[-]]<[-]<[-]]<[-]<[-]]<<[-]<[-]]>[<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++.++.+++++++.-----------------.---------------------------------------------
+------------------------.+++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++.+++++.++++++++++.--------.------------------------------------
+---------------------------------------.+++++++++++++++++.++++++++.-----------
+--------------.+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++.++++++++++++.---.--.--------------------------------------------------
+---------------------------.[-]>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++.[-][-]++++++++++++++++++++++++++++++++.+++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.-----.--------------
+-----------------------------------------------------------------.[-]<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>[-]+++>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[
+-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>][-]<[-]<<[->>+>+<<<]>>>[-<<<+>>>]<<[->>>[-]<[-]<[->
++>+<<]>>[-<<+>>]<[<->[-]]<<]<<[-]>>>>>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<[-]+>>>
+>[-]]<[-]<<[-]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>][-]+<<[>>[-]<<[-]]>>[<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>[-]]<<<[-]>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++.[-][-]++++++++++.[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-
+<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]<<
+[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]>[-]]>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]>[-]]>[-]<[-]<[->+>+<<]>>[-<<+>>]
+<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]>[-]]>[-]<[-]<[->+>+
+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++
+>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>[-]<[-]<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-
+]>[-]]>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]
+<[-]<[-]]<[-]<[-]]<[-]<[-]]<[-]<<[-]]>[-]<<[-]]<[-]<[-]]<<[-]<[-]]>[<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++.++.+++++++.-----------------.---------------------------------------------
+------------------------.+++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++.+++++.++++++++++.--------.------------------------------------
+---------------------------------------.+++++++++++++++++.+++++++.------------
+------------.+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++.++++++++++++.---.--.----------------------------------------------------
+-------------------------.[-]>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++.[-][-]++++++++++++++++++++++++++++++++.+++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++.-----.----------------------
+---------------------------------------------------------.[-]<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[
+-]+++>>>>[-]<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>][-]<<[-]<<[->>+>>+<<<<]>>>>[-<<<<+>>>>]<<<[->>[-]>[-]<<[->>+
+<+<]>[-<+>]>[<<->>[-]]<<<]<<[-]>>>>[-]>[-]<<[->>+<+<]>[-<+>]>[<<<<<[-]+>>>>>[-
+]]<<[-]<<[-]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>][-]+<<[>>[-]<<[-]]>>[<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>[-]]<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+++>>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]<<<[-]<[->+>>>+<<
+<<]>>>>[-<<<<+>>>>]<<[->[-]>[-]<<<[->>>+<+<<]>>[-<<+>>]>[<<<->>>[-]]<<]<<<[-]>
+>>>[-]>[-]<<<[->>>+<+<<]>>[-<<+>>]>[<<<<<[-]+>>>>>[-]]<<<[-]<[-]>[-]<[-]<[->+>
++<<]>>[-<<+>>][-]+<[>[-]<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<[-]>[-]<[-]<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++.[-][-]++++++++++.[-]<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>[-]<[-]
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]>[-]]>[-]<[-]<[->+>+<<]>>[-<
+<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>[-]+>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>]<[<[-]>[-]]>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]
++>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]
+<[<[-]>[-]]>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+
+>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>]<[<[-]>[-]]>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>[-]]<[-]<[-]]<[-]<[-]]<[-]<<[-]]>[-]<<[-]]<[-]<[-]]<[-]<[-]]<<[-]<[-]]>[<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++.++.+++++++.-----------------.-----------------------------------------
+----------------------------.+++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++.+++++.++++++++++.--------.--------------------------------
+-------------------------------------------.+++++++++++++++++.++++++.---------
+--------------.+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++.++++++++++++.---.--.--------------------------------------------------
+---------------------------.[-]>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.
+[-][-]++++++++++++++++++++++++++++++++.+++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++.-----.--------------------------
+-----------------------------------------------------.[-]<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+++>
+>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][
+-]<[-]<<[->>+>+<<<]>>>[-<<<+>>>]<<[->>>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<->[-]]<<]
+<<[-]>>>>>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<[-]+>>>>[-]]<[-]<<[-]>>[-]<<[-]<[->
++>>+<<<]>>>[-<<<+>>>][-]+<<[>>[-]<<[-]]>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<[-]>[-]<
+[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++.[-][-]++++++++++.[-]<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>>[-]<
+<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>
+[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>>
+[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-
+]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++
+++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]
+<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>]<[<[-]>[-]]>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>[-]+>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>]<[<[-]>[-]]>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>[-]]<[-]<[-]]<[-]<<[-]]>[-]<<[-]]<[-]<<[-]]>[-]<<[-]]<[-]<[-]]<<[-]<[-]]>[<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++.++.+++++++.-----------------.-----------------------------------------
+----------------------------.+++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++.+++++.++++++++++.--------.--------------------------------
+-------------------------------------------.+++++++++++++++++.+++++.----------
+------------.+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++.++++++++++++.---.--.----------------------------------------------------
+-------------------------.[-]>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-][-]++
+++++++++++++++++++++++++++++++.+++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++.-----.----------------------------------
+---------------------------------------------.[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+++>>>>[-]<<<[
+-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]<<[-]<<
+[->>+>>+<<<<]>>>>[-<<<<+>>>>]<<<[->>[-]>[-]<<[->>+<+<]>[-<+>]>[<<->>[-]]<<<]<<
+[-]>>>>[-]>[-]<<[->>+<+<]>[-<+>]>[<<<<<[-]+>>>>>[-]]<<[-]<<[-]>>[-]<<[-]<[->+>
+>+<<<]>>>[-<<<+>>>][-]+<<[>>[-]<<[-]]>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<[-]<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>[-]+++>>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>][-]<<<[-]<[->+>>>+<<<<]>>>>[-<<<<+>>>>]<<[->[-]>[-]<<<[->>>+<+<<]>>[
+-<<+>>]>[<<<->>>[-]]<<]<<<[-]>>>>[-]>[-]<<<[->>>+<+<<]>>[-<<+>>]>[<<<<<[-]+>>>
+>>[-]]<<<[-]<[-]>[-]<[-]<[->+>+<<]>>[-<<+>>][-]+<[>[-]<[-]]>[<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+[-]]<<[-]>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++.[-][-]++++++++++.[-]<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>[
+-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]>[-]]>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->
++>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++
+>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>
+>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->
++>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++
+++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>[-]+>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<
+[<[-]>[-]]>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<[-]<<[-
+]]>[-]<<[-]]<[-]<<[-]]>[-]<<[-]]<[-]<[-]]<[-]<[-]]<<[-]<[-]]>[<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.++.+++++
+++.-----------------.---------------------------------------------------------
+------------.+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++.+++++.++++++++++.--------.------------------------------------------------
+---------------------------.+++++++++++++++++.++++.---------------------.+++++
++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.++++++++++++
+.---.--.----------------------------------------------------------------------
+-------.[-]>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++.[-][-]++++++++++++++++++++++++++
+++++++.+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++.-----.----------------------------------------------------------
+---------------------.[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+++>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]<[-]<<[->>+>+<<<]>>>[-<<<+>>>]<<[->>>[-]<[-]<[
+->+>+<<]>>[-<<+>>]<[<->[-]]<<]<<[-]>>>>>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<[-]+>
+>>>[-]]<[-]<<[-]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>][-]+<<[>>[-]<<[-]]>>[<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>[-]]<<<[-]>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-][-]++++++++++.[-]<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>
+>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]<<[<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[-
+>+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++
+>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<
+<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]>[-]<<[-]
+]<[-]<<[-]]>[-]<<[-]]<[-]<<[-]]>[-]<<[-]]<[-]<[-]]<<[-]<[-]]>[<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>+>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+++>>>>[-]<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>>+<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]<<[-]<<[->>+>>+<<<<]>>>>[-<<<<+>>>>]<<<[->>[-
+]>[-]<<[->>+<+<]>[-<+>]>[<<->>[-]]<<<]<<[-]>>>>[-]>[-]<<[->>+<+<]>[-<+>]>[<<<<
+<[-]+>>>>>[-]]<<[-]<<[-]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>][-]+<<[>>[-]<<[-]]>
+>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>[-]]<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+++>>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]<<<[-]<[->+>>>+<<<<]>>>>[-<<<<+>>>>]<<[->[-]>
+[-]<<<[->>>+<+<<]>>[-<<+>>]>[<<<->>>[-]]<<]<<<[-]>>>>[-]>[-]<<<[->>>+<+<<]>>[-
+<<+>>]>[<<<<<[-]+>>>>>[-]]<<<[-]<[-]>[-]<[-]<[->+>+<<]>>[-<<+>>][-]+<[>[-]<[-]
+]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>[-]]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>[-]+>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]>[-]]>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[
+-]+>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>[-]+>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+
+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>
+[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<[-
+]<<[-]]>[-]<<[-]]<[-]<<[-]]>[-]<<[-]]<[-]<[-]]<[-]<[-]]<<[-]<[-]]>[<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>+>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+++>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>][-]<[-]<<[->>+>+<<<]>>>[-<<<+>>>]<<[->>>[-]<[-]<[->+>+<<]>
+>[-<<+>>]<[<->[-]]<<]<<[-]>>>>>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<[-]+>>>>[-]]<[
+-]<<[-]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>][-]+<<[>>[-]<<[-]]>>[<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]
++>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<
+[-]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<
+]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+
+>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>
+>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>
+[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]>[-]<<[-]]<[-]<<[-]]>[-]<<[-]]<[-]<<[-]]>[-
+]<<[-]]<[-]<[-]]<<[-]<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]
++++>>>>[-]<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]<<[-]<<[->>+>>+<<
+<<]>>>>[-<<<<+>>>>]<<<[->>[-]>[-]<<[->>+<+<]>[-<+>]>[<<->>[-]]<<<]<<[-]>>>>[-]
+>[-]<<[->>+<+<]>[-<+>]>[<<<<<[-]+>>>>>[-]]<<[-]<<[-]>>[-]<<[-]<[->+>>+<<<]>>>[
+-<<<+>>>][-]+<<[>>[-]<<[-]]>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+++>>>>[-]<<[-]<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]<<<[-]<[->+>>>+<<<<]>>>>[-<<<<+>>>>]<
+<[->[-]>[-]<<<[->>>+<+<<]>>[-<<+>>]>[<<<->>>[-]]<<]<<<[-]>>>>[-]>[-]<<<[->>>+<
++<<]>>[-<<+>>]>[<<<<<[-]+>>>>>[-]]<<<[-]<[-]>[-]<[-]<[->+>+<<]>>[-<<+>>][-]+<[
+>[-]<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>[-]]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>[-]+>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<
+[<[-]>[-]]>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+++
++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-
+<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]
+]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+
++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>
+[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>
++<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<[-]<<[-]]>[-]<<[-]]<[-]<<[-]]>[-]<<[-]]<[-
+]<[-]]<[-]<[-]]<<[-]<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+++
+>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]<[-]<<[->>+>+<<<]>>>[-<<<+>>>]<<[
+->>>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<->[-]]<<]<<[-]>>>>>[-]<[-]<[->+>+<<]>>[-<<+>
+>]<[<<<<[-]+>>>>[-]]<[-]<<[-]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>][-]+<<[>>[-]<<
+[-]]>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>[-]]<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>
+>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++
+++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<
+]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-
+]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>-
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]<<
+[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>[-]]>[-]<<[-]]<[-]<<[-]]>[-]<<[-]]<[-]<<[-]]>[-]<<[-]]<[-]<[-]]<<[-]<[-]]
+>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>
+>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+++>>>>[-]<<<[-]<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>>+<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>][-]<<[-]<<[->>+>>+<<<<]>>>>[-<<<<+>>>>]<<<[->>[-]>[-]<<[->>+<+
+<]>[-<+>]>[<<->>[-]]<<<]<<[-]>>>>[-]>[-]<<[->>+<+<]>[-<+>]>[<<<<<[-]+>>>>>[-]]
+<<[-]<<[-]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>][-]+<<[>>[-]<<[-]]>>[<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<
+<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>[-]+++>>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]<<<[-]<[->+>>>+<<<<]>
+>>>[-<<<<+>>>>]<<[->[-]>[-]<<<[->>>+<+<<]>>[-<<+>>]>[<<<->>>[-]]<<]<<<[-]>>>>[
+-]>[-]<<<[->>>+<+<<]>>[-<<+>>]>[<<<<<[-]+>>>>>[-]]<<<[-]<[-]>[-]<[-]<[->+>+<<]
+>>[-<<+>>][-]+<[>[-]<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>
+>>>>>>>>>>>>>>>>>>[-]+>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>
+>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]>[-]]>[-]<[-]<[
+->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>
+>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[
+-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>
+>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+++++++++
++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<
+[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
++>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[
+-]<<[-]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[
+-]]<[-]<<[-]]>[-]<<[-]]<[-]<<[-]]>[-]<<[-]]<[-]<[-]]<[-]<[-]]<<[-]<[-]]>[<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>+>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+++>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]<[-
+]<<[->>+>+<<<]>>>[-<<<+>>>]<<[->>>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<->[-]]<<]<<[-]
+>>>>>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<[-]+>>>>[-]]<[-]<<[-]>>[-]<<[-]<[->+>>+<
+<<]>>>[-<<<+>>>][-]+<<[>>[-]<<[-]]>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[
+-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<-
+>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>
+>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[
+-<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<
+[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>
+>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>
+>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-
+<+>>+<]>[-<+>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>
+>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>
+>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[-
+>+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>
+>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[
+-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[
+-]<<[-]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]>[-]<<[-]
+]<[-]<<[-]]>[-]<<[-]]<[-]<<[-]]>[-]<<[-]]<[-]<[-]]<<[-]<[-]]>[<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>+>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>[-]+++>>>>[-]<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]<<[-]<<[->>+>>+
+<<<<]>>>>[-<<<<+>>>>]<<<[->>[-]>[-]<<[->>+<+<]>[-<+>]>[<<->>[-]]<<<]<<[-]>>>>[
+-]>[-]<<[->>+<+<]>[-<+>]>[<<<<<[-]+>>>>>[-]]<<[-]<<[-]>>[-]<<[-]<[->+>>+<<<]>>
+>[-<<<+>>>][-]+<<[>>[-]<<[-]]>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+++>>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]
+[-]<<<[-]<[->+>>>+<<<<]>>>>[-<<<<+>>>>]<<[->[-]>[-]<<<[->>>+<+<<]>>[-<<+>>]>[<
+<<->>>[-]]<<]<<<[-]>>>>[-]>[-]<<<[->>>+<+<<]>>[-<<+>>]>[<<<<<[-]+>>>>>[-]]<<<[
+-]<[-]>[-]<[-]<[->+>+<<]>>[-<<+>>][-]+<[>[-]<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<[-]<<<<<<<<<<<<<<<<<
+<<<<<<->>>>>>>>>>>>>>>>>>>>>>>[-]+>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>
+>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<
+<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>]<[<[-]>[-]]>[-]<[-]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>[-]+>>>
+[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<
+<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>
+>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<
+<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<
+<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<]
+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>
+>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<[-]+
++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<
+<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<
+<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<
+<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+++++
++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<[-]<<[-]]>[-]<<[-]]<
+[-]<<[-]]>[-]<<[-]]<[-]<[-]]<[-]<[-]]<<[-]<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>[-]+++>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]<[-]<<[->>+>+<<<]>>>[-<<<+>>>]<<[->>>[-]<[-
+]<[->+>+<<]>>[-<<+>>]<[<->[-]]<<]<<[-]>>>>>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<[-
+]+>>>>[-]]<[-]<<[-]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>][-]+<<[>>[-]<<[-]]>>[<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+]]<<<[-]<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<
+<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>
+>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]
+<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>
+>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>+>>+
+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<+>>
+>>>>>>>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<<<
+<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<<<<<
+<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>
+>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[
+-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++
+>->>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>
+>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<
+<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<
+]>[-<+>]<<[<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>[-]
++>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]
+<<[<<<<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-
+]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<
+<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>>[-]]>[-]<<[-]]<[-]<<[-]
+]>[-]<<[-]]<[-]<<[-]]>[-]<<[-]]<[-]<[-]]<<[-]<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>[-]+++>>>>[-]<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]<<[-]<<[->>+>>+<<<<]>>>>[-<<<<+>>>>]<<<[-
+>>[-]>[-]<<[->>+<+<]>[-<+>]>[<<->>[-]]<<<]<<[-]>>>>[-]>[-]<<[->>+<+<]>[-<+>]>[
+<<<<<[-]+>>>>>[-]]<<[-]<<[-]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>][-]+<<[>>[-]<<[
+-]]>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>[-]]<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>[-]+++>>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]<<<[-]<[->+>>>+<<<<]>>>>[-<<<<+>>>>]<<[->[-
+]>[-]<<<[->>>+<+<<]>>[-<<+>>]>[<<<->>>[-]]<<]<<<[-]>>>>[-]>[-]<<<[->>>+<+<<]>>
+[-<<+>>]>[<<<<<[-]+>>>>>[-]]<<<[-]<[-]>[-]<[-]<[->+>+<<]>>[-<<+>>][-]+<[>[-]<[
+-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>[-]]<<[-]<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>[-]+>>[-]<[-]<<<<<<<<<<<<<<<
+<<<<<[->>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-<<<
+<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>]<[<[-]>[-]]>[-]<[-]<[->+>+<<]>>[-<<+>
+>]<[<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<
+<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>
+>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[
+-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>
+>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>+>>+<<
+<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>
+>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<<<<<<<<<
+<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<[
+->>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>
+>[-<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<
+[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>
+>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+>>+<<
+<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<+>
+>>>>>>>>>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<
+<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<
+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>
+>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>
+]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<[-
+]++++++++++>->>>>>>>>>>>>>>>>>>>>>>>>[-]]<[-]<<[-]]>[-]<<[-]]<[-]<<[-]]>[-]<<[
+-]]<[-]<[-]]<[-]<[-]]<<[-]<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+++>>>[-]
+<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+
+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]
+[-]<[-]<<[->>+>+<<<]>>>[-<<<+>>>]<<[->>>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<->[-]]<<
+]<<[-]>>>>>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<[-]+>>>>[-]]<[-]<<[-]>>[-]<<[-]<[-
+>+>>+<<<]>>>[-<<<+>>>][-]+<<[>>[-]<<[-]]>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<[-]<<<<<<<<<<<<<<<<<->>>>>>>>>>
+>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<
+<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<<[<[-]
+>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<[-]++++++++++>->>
+>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+>>+<<<<<<
+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>
+]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<<<<<<<<[-]++++++++++>->>
+>>>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>+>>+
+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>
+>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<
+<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<
+<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]
+<<[<<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<
+<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>
+>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[
+-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<[-]++++++++++>-
+>>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>
+>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<
+<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]<<[<<<<<
+<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>>[-]]>[-]<<[-]]<[-]<<[-]]>
+[-]<<[-]]<[-]<<[-]]>[-]<<[-]]<[-]<[-]]<<[-]<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>[-]+++>>>>[-]<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>][-]<<[-]<<[->>+>>+<<<<]>>>>[-<<<<+>>>>]<<<[->>[-]>[-]<<[->>+<+
+<]>[-<+>]>[<<->>[-]]<<<]<<[-]>>>>[-]>[-]<<[->>+<+<]>[-<+>]>[<<<<<[-]+>>>>>[-]]
+<<[-]<<[-]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>][-]+<<[>>[-]<<[-]]>>[<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<[-]<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+++>>>>[-]<<[-]<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]<<<
+[-]<[->+>>>+<<<<]>>>>[-<<<<+>>>>]<<[->[-]>[-]<<<[->>>+<+<<]>>[-<<+>>]>[<<<->>>
+[-]]<<]<<<[-]>>>>[-]>[-]<<<[->>>+<+<<]>>[-<<+>>]>[<<<<<[-]+>>>>>[-]]<<<[-]<[-]
+>[-]<[-]<[->+>+<<]>>[-<<+>>][-]+<[>[-]<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<[-]<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>
+[-]+>>[-]<[-]<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<]>>>>>>>>>>
+>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]<[<[-]>[-]]>[-]<[-]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<
+<<<<<<<<<[->>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>[-<<<<<
+<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+
+>>>]<<[<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<
+<<<<<<<<<[->>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>[-<<<<<
+<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]<<[<
+<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<<<
+<<<<<[->>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-<<<
+<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>
+[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>[-]+>[-]<<[
+-]<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>
+>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-
+]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>>[-]
++>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<
+<<<<<]>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>
+]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<[-]+++
++++++++>->>>>>>>>>>>>>>>>>>>>[-]]<[-]<<[-]]>[-]<<[-]]<[-]<<[-]]>[-]<<[-]]<[-]<
+[-]]<[-]<[-]]<<[-]<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]
++>>>>>>>>>>>>>>>>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+++>>>[-]<<[-]<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]<[-]<<[->>+>+<<<]>>>[
+-<<<+>>>]<<[->>>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<->[-]]<<]<<[-]>>>>>[-]<[-]<[->+>
++<<]>>[-<<+>>]<[<<<<[-]+>>>>[-]]<[-]<<[-]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>][-
+]+<<[>>[-]<<[-]]>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>[-]]<<<[-]<<<<<<<<<<<<<->>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<<<
+[->>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>
+>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<[-]
+++++++++++>->>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+>>+<<<<
+<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>
+>[-]<<[-]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>[-]+>
+>>[-]<<[-]<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>
+>>>>>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<
+<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>[-]+>[-]<<[
+-]<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>[
+-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]
+<<[<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<
+<<<<<<[->>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<<<<
+<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<
+<+>>>]<<[<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<
+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>
+>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>
+[-<+>]<<[<<<<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>>[-]]>[-]<<[-]]<[-]<
+<[-]]>[-]<<[-]]<[-]<<[-]]>[-]<<[-]]<[-]<[-]]<<[-]<[-]]>[<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>[-]+++>>>>[-]<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>][-]<<[-]<<[->>+>>+<<<<]>>>>[-<<<<+>>>>]<<<[->>[-]>[-]<<[->>+<+<]>[-<+>]>
+[<<->>[-]]<<<]<<[-]>>>>[-]>[-]<<[->>+<+<]>[-<+>]>[<<<<<[-]+>>>>>[-]]<<[-]<<[-]
+>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>][-]+<<[>>[-]<<[-]]>>[<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<[-]<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+++>>>>[-]<<[-]<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]<<<[-]<[->+>>>+<<<<]>>>>[-<<<<+>>
+>>]<<[->[-]>[-]<<<[->>>+<+<<]>>[-<<+>>]>[<<<->>>[-]]<<]<<<[-]>>>>[-]>[-]<<<[->
+>>+<+<<]>>[-<<+>>]>[<<<<<[-]+>>>>>[-]]<<<[-]<[-]>[-]<[-]<[->+>+<<]>>[-<<+>>][-
+]+<[>[-]<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>[-]]<<[-]<<<<<<<<<<<->>>>>>>>>>>[-]+>>[-]<[-]<<<<<<<<<<<<[->>>>>>>>>>>>+>+
+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<[<[-]>[-]]>[-]<[-]<[
+->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<
+<<<<<<<<<[->>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>
+>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<
+[-]++++++++++>->>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<[->>>>>>>>>>>>>+>>+<<<<
+<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]
+<<[-]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>[-]+>>>[-]<
+<[-]<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>[-<
+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+
+>>>]<<[<<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<
+<<<[->>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<
++>>>>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<<<<<[-
+]++++++++++>->>>>>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>
+>>+>>+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>
+>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<[-
+]++++++++++>->>>>>>>>>>>>>>>>[-]]<[-]<<[-]]>[-]<<[-]]<[-]<<[-]]>[-]<<[-]]<[-]<
+[-]]<[-]<[-]]<<[-]<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>
+>>>>>>>>>>>>>>>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+++>>>[-]<<[-]<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]<[-]<<[->>+>+<<<]>>>[-<<<+>>>]<<[->>>
+[-]<[-]<[->+>+<<]>>[-<<+>>]<[<->[-]]<<]<<[-]>>>>>[-]<[-]<[->+>+<<]>>[-<<+>>]<[
+<<<<[-]+>>>>[-]]<[-]<<[-]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>][-]+<<[>>[-]<<[-]]
+>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<[
+-]<<<<<<<<<->>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<[->>>>>>>>>>+>>+<<<<<<<<<<<<]>>>
+>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<
+<+>>>]<<[<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<[->>>>>>>>
+>>+>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<
+[-]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>[-]+>>>[-]<<[-]<<<<
+<<<<<<<<[->>>>>>>>>>>>+>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>
+>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<[-]++++
+++++++>->>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<[->>>>>>>>>>>>+>>+<<<<<<<<<<<<<<
+]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<[>[-]<[-]]>>[-]<<[-]>[-<+>>+<
+]>[-<+>]<<[<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>[-]+>>>[-]<<[-]<<<<<<<<<<<<
+<<[->>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>
+>>>>>>>>>>>>]<<[<[-]>[-]]>>[-]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<[
+-]++++++++++>->>>>>>>>>>>>>>>[-]+>[-]<<[-]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+>>+<<
+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<[>[-]<[-]
+]>>[-]<<[-]>[-<+>>+<]>[-<+>]<<[<<<<<<<<<<<<<<[-]++++++++++>->>>>>>>>>>>>>[-]]>
+[-]<<[-]]<[-]<<[-]]>[-]<<[-]]<[-]<<[-]]>[-]<<[-]]<[-]<[-]]<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+[-]+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++.++.+++++++.-----------------.++++++++++++++
+.---------------------------------------------------------.-------------------
+-------.[-][-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<[->-<
+]>.[-][-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<<[->>-<<]>
+>.[-][-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<<<[->>>-<<<
+]>>>.[-][-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<<<<[->>>
+>-<<<<]>>>>.[-][-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<<
+<<<[->>>>>-<<<<<]>>>>>.[-][-]+++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++<<<<<<[->>>>>>-<<<<<<]>>>>>>.[-][-]++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++<<<<<<<[->>>>>>>-<<<<<<<]>>>>>>>.[-][-]++++++++++.++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++.-----------.++.++++++++++++.-----------------------------
+----------------------------.--------------------------.[-]>[-]<[-]<<<<<<<<[->
+>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++.[-]>[-]<[-]<<<<<<<<<[->>>>>>>>>+>+<<<<
+<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++.[-]>[-]<[-]<<<<<<<<<<[->>>>>>>>>>+>+<<<<<<<<<<<]
+>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++.[-]>[-]<[-]<<<<<<<<<<<[->>>>>>>>>>>+>+<<<<<<<<<<<<]>
+>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++.[-]>[-]<[-]<<<<<<<<<<<<[->>>>>>>>>>>>+>+<<<<<<<<<<
+<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++.[-]>[-]<[-]<<<<<<<<<<<<<[->>>>>>>>>>>>>+>+
+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++.[-]>[-]<[-]<<<<<<<<<<<<<<[->
+>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>
+>>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]>[-]<
+[-]<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<
+<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++.[-]>[-]<[-]<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<
+<<<<<]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]<++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++.[-]>[-]<[-]<<<<<<<<<<<<<<<<<
+[->>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<
+<+>>>>>>>>>>>>>>>>>>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++.[-]>[-]<[-]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<
+<<<]>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>]<++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]>[-]<[-]<<<<<<<<<<<<<
+<<<<<<[->>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<<<<
+<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++.[-]>[-]<[-]<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>
+>+>+<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<+>>>>>>>
+>>>>>>>>>>>>>>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++.[-]>[-]<[-]<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<
+<<<<<<]>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>]<
++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]>[-]<[-]<
+<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>
+>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>]<++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]>[-]<[-]<<<<<<<<<<<
+<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>
+>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]<++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]>[-]<[-]<<<<<<<<<<<<<<<
+<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>
+>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>]<++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]>[-]<[-]<<<<<<<<<<<<<
+<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>
+>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>]<++++
++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]>[-]<[-]<<<<<
+<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<
+<]>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>
+>>>>>>>>]<+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-
+]>[-]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<+
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++.[-][-]++++++++++.[-]
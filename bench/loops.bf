@@ -0,0 +1,50 @@
+Three nested counting loops (240 times 250 times 250) whose body updates a
+few running sums; prints the sums at the end
+
+[-]----------------[->[-]------[->[-]------[->+++>>>[-]<<<[->+>>+<<<]>>>[-<<<+
+>>>][-]<<[->+++++++>+<<]>>[-<<+>>]<<<<]>+<<]<]>>>>>>>>>>>[-]<[-]<<<<<<<[->>>>>
+>>+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<[-]>[-]>>>>[-]+++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++<[-<<<+>>>>->[-]+>>[-]<[-]<<[->>+>+<<<]>>>[-<<<+>>>]<[<[-]>[-]]>[-]<[-]<[
+->+>+<<]>>[-<<+>>]<[<<<<<<<+>[-]>>>>[-]+++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++>>[-]]<[-]<<]>[-]
+>>[-]<[-]<<<<<[->>>>>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<[-]<[-]>>>[-]++++++++++
+<[-<<+>>>->[-]+>>[-]<[-]<<[->>+>+<<<]>>>[-<<<+>>>]<[<[-]>[-]]>[-]<[-]<[->+>+<<
+]>>[-<<+>>]<[<<<<+<[-]>>>[-]++++++++++>>[-]]<[-]<<]>[-][-]>[-]<<[-]<<<<<<[->>>
+>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[<<<<<<+++++++++++++++++++++++++
++++++++++++++++++++++++.------------------------------------------------>>>>>>
+>[-]+<[-]][-]<[->>+<+<]>[-<+>]>>[-]<<[-]>[-<+>>+<]>[-<+>]<<[<+++++++++++++++++
++++++++++++++++++++++++++++++++.----------------------------------------------
+-->[-]]<<++++++++++++++++++++++++++++++++++++++++++++++++.<<<<[-]>[-]>[-]>[-]>
+>[-]<[-]>>>[-][-]++++++++++.[-]<<<<<<[-]>[-]<<<<[->>>>+<+<<<]>>>[-<<<+>>>]>>>>
+>>[-]<<<[-]<<<[-]+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++>[->>+<<<-<[-]+>>>>>>>>[-]<<[-]<<<<<[->
+>>>>+>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<[<<<<<<[-]>>>>>>[-]]>>[-]<<[-]<<<<<
+<[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[>+<<<[-]<<<[-]+++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++>>>>>[-]]<<<<<<[-]>>]<[-]>>>>>[-]<<<<<<[-]>>>>[-<<<<+>>>>>>+<<]>>[-
+<<+>>]<<<<<[-]>[-]>>>>[-]++++++++++<<<<<<[->>+>>>>->>[-]+>>[-]<[-]<<<[->>>+>+<
+<<<]>>>>[-<<<<+>>>>]<[<[-]>[-]]>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<+>[-]>>>>
+[-]++++++++++>>>[-]]<[-]<<<<<<<<]>>>>>>[-][-]>>[-]<<<<<<<<[-]>>>>>>>[-<<<<<<<+
+>>>>>>>>+<]>[-<+>]<<<<<<<<[>>>>>>>++++++++++++++++++++++++++++++++++++++++++++
+++++.------------------------------------------------<[-]+<<<<<<[-]][-]>[->>>>
+>+<<<<<<+>]<[->+<]>>>>>>>>[-]<<<<<<<<[-]>>>>>>[-<<<<<<+>>>>>>>>+<<]>>[-<<+>>]<
+<<<<<<<[>++++++++++++++++++++++++++++++++++++++++++++++++.--------------------
+----------------------------<[-]]>>+++++++++++++++++++++++++++++++++++++++++++
++++++.>>>>>[-]<<<[-]>[-]<<[-]<<[-]>[-]>>>>[-][-]++++++++++.[-]<<[-]>[-]<<<<<<[
+->>>>>>+<+<<<<<]>>>>>[-<<<<<+>>>>>]>>[-]<<<<[-]>>[-]++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++>[-<
+<<+>>->>>[-]+>[-]<<<<<<<<[-]>>>>[-<<<<+>>>>>>>>+<<<<]>>>>[-<<<<+>>>>]<<<<<<<<[
+>>>>>>>[-]<<<<<<<[-]]>>>>>>>>[-]<<<<<<<<[-]>>>>>>>[-<<<<<<<+>>>>>>>>+<]>[-<+>]
+<<<<<<<<[>>>>>>+<<<<[-]>>[-]++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++<<<<[-]]>>>>>>>[-]<<]<[-]<<<
+<[-]>>>>>>>[-]<<<<<[->>>>>+<<<<<<<+>>]<<[->>+<<]>>>>[-]>[-]<<<<<[-]++++++++++>
+>>>>>>[-<<+<<<<<->>>>>>>>[-]+>>[-]<[-]<<<<<<<<<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>
+>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<[-]>[-]]>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<+>[-
+]<<<<<[-]++++++++++>>>>>>>>>[-]]<[-]<]<<<<<<<[-][-]>>>>>>>>[-]<[-]<[->+>+<<]>>
+[-<<+>>]<[<++++++++++++++++++++++++++++++++++++++++++++++++.------------------
+------------------------------<<<<<<[-]+>>>>>>>[-]][-]<<<[-<<<<+>>>>>>>+<<<]>>
+>[-<<<+>>>]>[-]<[-]<<<<<<<[->>>>>>>+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[<
+<<++++++++++++++++++++++++++++++++++++++++++++++++.---------------------------
+--------------------->>>[-]]<<++++++++++++++++++++++++++++++++++++++++++++++++
+.>[-]<<<<[-]<[-]>>[-]>[-]>[-]<<<<<[-][-]++++++++++.[-]
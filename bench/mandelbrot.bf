@@ -0,0 +1,127 @@
+Mandelbrot set in 8 bit fixed point arithmetic with four fractional bits
+The real axis goes from minus two to one in steps of one sixteenth and the
+imaginary axis from minus one to one in steps of one eighth; each point gets
+up to 64 iterations and is shaded by how quickly it escapes
+
+[-]---------------->[-]+++++++++++++++++[->[-]--------------------------------
+>[-]++++++++++++++++++++++++++++++++++++++++++++++++[->[-]>[-]>[-]++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++>[-]+>[-]<[>>>>>>>>>>>>>>>
+>[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++>>>[-]<<[-]<<<<<<<<<<<<<
+<<<<<<<[->>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>
+[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>][-]<[-]<<[->>+>+<<<]>>>[-<<<+>
+>>]<<[->>>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<->[-]]<<]<<<<<<<<<<[-]>>>>>>>>>>>>>[-]
+<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<[-]+>>>>>>>>>>>>[-]]<[-]<<[-]<<<<<<<<<<<
+<<<[-]+>>>>>>>>>>>>>>>>[-]<<[-]<<<<<<<<<[->>>>>>>>>+>>+<<<<<<<<<<<]>>>>>>>>>>>
+[-<<<<<<<<<<<+>>>>>>>>>>>]<<[<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>[-]][-]<<<<<<<<<<<
+<<[-]<<<<<<[->>>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>[-<<<
+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>]>>[-]<<[-]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+
+>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<[>>[
+-]<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<
+<<<<<->>>>>>>>>>>>>>>]<<[-]][-]+++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++>>>[-]<[-]<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<
+<]>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>][-]<<[-]<
+[->+>>+<<<]>>>[-<<<+>>>]<[->>[-]<[-]<<[->>+>+<<<]>>>[-<<<+>>>]<[<<->>[-]]<]<<<
+<<<<<<<<[-]>>>>>>>>>>>>>[-]<[-]<<[->>+>+<<<]>>>[-<<<+>>>]<[<<<<<<<<<<<<[-]+>>>
+>>>>>>>>>[-]]<<[-]<[-]<<<<<<<<<<<<[-]+>>>>>>>>>>>>>[-]<[-]<<<<<<<<<[->>>>>>>>>
++>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<<<<<<<<<<<<[-]>>>>>>>>>>>>[
+-]][-]<<<<<<<<<<<[-]<<<<<<<[->>>>>>>+>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>
+>>>>>>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]>[-]<[-]<<<<<<<<<<<<[->>>>>>>>
+>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<[>[-]<<<<<<<<
+<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<->>>>>>>>>>>>]<[-]][
+-]+++++++++++++++++++++++++++++++++>>>[-]<<[-]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+>
+>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>][-]<[-]
+<<[->>+>+<<<]>>>[-<<<+>>>]<<[->>>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<->[-]]<<]<<<<<<
+<<<<<[-]>>>>>>>>>>>>>>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<[-]+>>>>>>>>>>
+>>>[-]]<[-]<<[-][-]+++++++++++++++++++++++++++++++++>>>[-]<[-]<<<<<<<<<<<<<[->
+>>>>>>>>>>>>+>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>][-
+]<<[-]<[->+>>+<<<]>>>[-<<<+>>>]<[->>[-]<[-]<<[->>+>+<<<]>>>[-<<<+>>>]<[<<->>[-
+]]<]<<<<<<<<<<<[-]>>>>>>>>>>>>>[-]<[-]<<[->>+>+<<<]>>>[-<<<+>>>]<[<<<<<<<<<<<<
+[-]+>>>>>>>>>>>>[-]]<<[-]<[-]>[-]<[-]<<<<<<<<<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>
+>>>[-<<<<<<<<<<+>>>>>>>>>>][-]+<[>[-]<[-]]>[<<<<<<<<<<<[-]>>>>>>>>>>>[-]][-]<[
+-]<<<<<<<<<<[->>>>>>>>>>+>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<[
+<<<<<<[-]>[-]>>>>>>[-]<<[-]<<<<<<<<<<<<[->>>>>>>>>>>>+>>+<<<<<<<<<<<<<<]>>>>>>
+>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<[->>[-]<<<[-]<<<<<<<<<<<[->>>>>>>>>>
+>+>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<[-<<<<+>
+>>>>>>[-]+>>[-]<[-]<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>
+>>]<[<[-]>[-]]>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<+>>>>>>>[-]]<[-]<<<]>]>>>>>
+[-]<[-]<<<<<<<<<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<
+[-]>[-]>>[-]++++++++++++++++<[-<+>>->[-]+>>[-]<[-]<<[->>+>+<<<]>>>[-<<<+>>>]<[
+<[-]>[-]]>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<+>[-]>>[-]++++++++++++++++>>[-]]<[
+-]<<]>[-]<<<<<<<<<<<<[-]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>>>[-]<<<<<<<<<[-<<<+++
++++++++++++++>>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<[-]<<<<<<
+<<[-]>[-]>>>>>>>[-]<<<[-]<<<<<<<<<<[->>>>>>>>>>+>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>
+>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<<<[->>>[-]<<<<[-]<<<<<<<<<[->>>>>>>>>+>>>>+<<<
+<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<<<<[-<<<<+>>>>>>>>[-]+>
+>[-]<<<[-]<<<<<<<[->>>>>>>+>>>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<
+<[>[-]<[-]]>>>[-]<<<[-]>[-<+>>>+<<]>>[-<<+>>]<<<[<<<<<<+>>>>>>[-]]>[-]<<<<]>]>
+>>>[-]>[-]<<<<<<<<<<[->>>>>>>>>>+<+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[
+-]<[-]>>[-]++++++++++++++++>[-<<<+>>->>[-]+>>[-]<[-]<<<[->>>+>+<<<<]>>>>[-<<<<
++>>>>]<[<[-]>[-]]>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<+<[-]>>[-]++++++++++++++++>
+>>[-]]<[-]<]<[-]<<<<<<<<<<[-]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>[-]<<<<<<<<[-<<++
+++++++++++++++>>>>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[-]>[-]<[-]<<<
+<<<<<<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>][-]<<<<<<<<<[
+->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>][-]++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++>>>[-]<<[-]<<[->>+>>+<<<<]>>>>[-<<<
+<+>>>>][-]<[-]<<[->>+>+<<<]>>>[-<<<+>>>]<<[->>>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<-
+>[-]]<<]<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<
+<<<[-]+>>>>>>>>>>>>>>[-]]<[-]<<[-]<[-]>[-]<[-]<<<<<<<<<<[->>>>>>>>>>+>+<<<<<<<
+<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>][-]+<[>[-]<[-]]>[<<<<<<<<<<<<[-]>>>>
+>>>>>>>>[-]]<<[-]]>[-]<[-]<<<<<<<<<<[->>>>>>>>>>+>+<<<<<<<<<<<]>>>>>>>>>>>[-<<
+<<<<<<<<<+>>>>>>>>>>>][-]+<[<<<<<<[-]>[-]>>>>>>>[-]<<<[-]<<<<<<<<<<[->>>>>>>>>
+>+>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<<<[->>>[-]<<<<
+[-]<<<<<<<<<<<[->>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>>]<<<<[-<<<<+>>>>>>>>[-]+>[-]>[-]<<<<<<<<<<[->>>>>>>>>>+<+<<
+<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>[<<[-]>>[-]]<[-]>[-]<<[->>+<+<]>[-<+>]
+>[<<<<<<<<<+>>>>>>>>>[-]]<<[-]<<<<]>]>>>>>>[-]<<[-]<<<<<<<<<[->>>>>>>>>+>>+<<<
+<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<[-]>>[-]>[-]++++++++<<[->+>->
+[-]+>>[-]<[-]<<[->>+>+<<<]>>>[-<<<+>>>]<[<[-]>[-]]>[-]<[-]<[->+>+<<]>>[-<<+>>]
+<[<<<<<+>>[-]>[-]++++++++>>[-]]<[-]<<<]>>[-]<<<<<<<<<[-]>>>>>>[-<<<<<<+>>>>>>]
+>>>[-]<<<<<<<<<<[->++++++++++++++++++++++++++++++++>>>>>>>>>+<<<<<<<<<<]>>>>>>
+>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[-][-]<<<<<<<[-]<<<<<<<<<[->>>>>>>>>+>>>>>>>+<<<<
+<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<[-]>>[-]<<<
+<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<
+<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>[>[-]<<<[-]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+>>>+
+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>][-]+<
+<<[<<<<<[-]>>>>>>>>[-]<<<[-]]>>>[<<<<<<<<[-]+>>>>>>>>[-]]<[-]]<<[-]>>[-]<<<<<<
+<[->>>>>>>+<<+<<<<<]>>>>>[-<<<<<+>>>>>]>>[<<[-]<<<<<<[->>>>>>+<<<<<<]>>>>>>[-<
+<<<<<->>>>>>]>>[-]]<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>
+>>>>>>>>>>>]>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>+>>>>>>>>>>>>>>>>>>>>
+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>[-<
+<<<<<<<<<<+>>>>>>>>>>>]>[-<<<<<<<<<<<<->>>>>>>>>>>>]>>>>>>>>>>>[-]<<<<<<<<<<<<
+<<<<<<<<<<<<<[->>+>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>
+>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<
+<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<<[-]<<<<<<<<<<<<<<<<<<<[->>>>>>>>>
+>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<
+<<<<<<+>>>>>>>>>>>>>>>>>>>>>>]<<<[>>[-]<<[-]]>>>[-]<<<[-]>>[-<<+>>>+<]>[-<+>]<
+<<[<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>[-]]>>[-]<<<[-]<[-]]>[<<<<<<<<<<<<<<
+<<[-]+<[-]>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<[-]>[-]>[-]>[-]>[-]>[-]>[-]>[-]>
+[-]>[-]>[-]>[-]<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-]++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>-<<<<<<<
+<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-]<<<[-]<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+>>
+>+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>
+>>>>][-]+<<<[>>>>[-]++>>[-]<<<<[-]<<<[->>>+>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>
+>>][-]<[-]<[->+>+<<]>>[-<<+>>]<<<<[->>>>>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<->[-]]<
+<<<]<[-]>>>>>>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<[-]+>>>>>[-]]<[-]<[-]>[-]<[-]<
+<<[->>>+>+<<<<]>>>>[-<<<<+>>>>][-]+<[<<[-]++++++++++++++++++++++++++++++++.[-]
+>>>[-]<[-]]>[>[-]++++>>>[-]<<[-]<<<<<<<<[->>>>>>>>+>>+<<<<<<<<<<]>>>>>>>>>>[-<
+<<<<<<<<<+>>>>>>>>>>][-]<[-]<<[->>+>+<<<]>>>[-<<<+>>>]<<[->>>[-]<[-]<[->+>+<<]
+>>[-<<+>>]<[<->[-]]<<]<<<<<[-]>>>>>>>>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<[-]+
+>>>>>>>[-]]<[-]<<[-]>>[-]<<[-]<<<<[->>>>+>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>][-]+<
+<[>[-]++++++++++++++++++++++++++++++++++++++++++++++.[-]>[-]<<[-]]>>[>[-]+++++
++>>>[-]<<[-]<<<<<<<<<<<[->>>>>>>>>>>+>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<+>>>>>>>>>>>>>][-]<[-]<<[->>+>+<<<]>>>[-<<<+>>>]<<[->>>[-]<[-]<[->+>+<<]>>
+[-<<+>>]<[<->[-]]<<]<<<[-]>>>>>>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<[-]+>>>>>[-]
+]<[-]<<[-]>>[-]<<[-]<<[->>+>>+<<<<]>>>>[-<<<<+>>>>][-]+<<[>[-]++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++.[-]>[-]<<[-]]>>[>[-]+++++++++>>>[-]
+<<[-]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<
+<<<<<<<<<<<<+>>>>>>>>>>>>>>>>][-]<[-]<<[->>+>+<<<]>>>[-<<<+>>>]<<[->>>[-]<[-]<
+[->+>+<<]>>[-<<+>>]<[<->[-]]<<]<<<[-]>>>>>>[-]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<[
+-]+>>>>>[-]]<[-]<<[-]>>[-]<<[-]<<[->>+>>+<<<<]>>>>[-<<<<+>>>>][-]+<<[>[-]+++++
+++++++++++++++++++++++++++++++++++++++.[-]>[-]<<[-]]>>[<[-]+++++++++++++++++++
++++++++++++++++++++++++.[-]>[-]]<<<<[-]>[-]]<<<<[-]>[-]]<<<<<<[-]>>>[-]]<<<<[-
+]>>[-]<<<[-]]>>>[<<[-]+++++++++++++++++++++++++++++++++++.[-]>>[-]]<<<<[-]<<<<
+<<<<<<<<<<<[-]<<<<<<+>]>>>>>>>>>>>>>>>>>>>>[-]++++++++++.[-]<<<<<<<<<<<<<<<<<<
+<<<<<++>]
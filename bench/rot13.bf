@@ -0,0 +1,29 @@
+ROT13 filter from the Brainfuck article on Wikipedia; reads until end of
+input and needs end of file to leave the cell alone or to store minus one
+
+-,+[
+  -[
+    >>++++[>++++++++<-]
+    <+<-[
+      >+>+>-[>>>]
+      <[[>+<-]>>+>]
+      <<<<<-
+    ]
+  ]>>>[-]+
+  >--[-[<->+++[-]]]<[
+    ++++++++++++<[
+      >-[>+>>]
+      >[+[<+>-]>+>>]
+      <<<<<-
+    ]
+    >>[<+>-]
+    >[
+      -[
+        -<<[-]>>
+      ]<<[<<->>-]>>
+    ]<<[<<+>>-]
+  ]
+  <[-]
+  <.[-]
+  <-,+
+]
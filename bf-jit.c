@@ -1,12 +1,25 @@
+#define _GNU_SOURCE
+#include <elf.h>
+#include <emmintrin.h>
+#include <setjmp.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdatomic.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/mman.h>
+#include <sys/uio.h>
+#include <time.h>
 
 #define NOB_IMPL
 #include "nob.h"
 
+#include "bf-jit.h"
+
 typedef enum {
   OP_INC = '+',   // increase the current byte by 1
   OP_DEC = '-',   // decrease the current byte by 1
@@ -19,11 +32,26 @@ typedef enum {
                             // current byte is 0
   OP_JMP_IF_NON_ZERO = ']', // jumps to instruction next to corresponding '[' if
                             // current byte in not 0
+  OP_SET = '=', // sets the current byte to the operand, not a token of the
+                // language but what the parser makes out of `[-]+++`
+  OP_MUL = '*', // adds the current byte times the operand to the byte at
+                // offset, made out of loops like `[->++<]`
+  OP_SCAN_LEFT = '(',  // moves the pointer left in steps of operand until it
+                       // finds a zero byte, made out of `[<]`, `[<<]`, ...
+  OP_SCAN_RIGHT = ')', // same to the right, made out of `[>]`, `[>>]`, ...
+  OP_CHECK = '?', // fails unless the bytes from offset to operand around the
+                  // pointer are all on the tape, put in front of a run of
+                  // operators which address their bytes relative to the
+                  // pointer instead of moving it
 } Operator_Kind;
 
 typedef struct {
   Operator_Kind op_kind;
   size_t operand;
+  ptrdiff_t offset; // distance of the byte the operator works on from the
+                    // pointer, for OP_MUL that is the byte it adds to
+  ptrdiff_t source; // distance of the byte an OP_MUL multiplies, for a '['
+                    // where it is in the source file
 } Operator;
 
 typedef struct {
@@ -32,22 +60,73 @@ typedef struct {
   size_t capacity;
 } Program;
 
+// appends op to the program, changes to a cell of known value are folded into
+// the OP_SET that gave it that value. The value wraps at 64 bits, whatever
+// runs it cuts it down to the width of the cells.
+void program_append(Program *program, Operator op) {
+  Operator *last =
+      program->count ? program->items + program->count - 1 : NULL;
+  if (last && last->op_kind == OP_SET && last->offset == op.offset &&
+      (op.op_kind == OP_INC || op.op_kind == OP_DEC)) {
+    last->operand = op.op_kind == OP_INC ? last->operand + op.operand
+                                         : last->operand - op.operand;
+    return;
+  }
+  nob_da_append(program, op);
+}
+
 typedef struct {
   NOB_String_View content;
   size_t pos;
 } Lexer;
 
-bool is_bf_token(char ch) {
-  const char *cmds = "+-<>.,[]";
-  return strchr(cmds, ch);
+// the bytes that are commands of the language, everything else is a comment
+static const bool bf_tokens[256] = {
+    ['+'] = true, ['-'] = true, ['<'] = true, ['>'] = true,
+    ['.'] = true, [','] = true, ['['] = true, [']'] = true,
+};
+
+// bit i is set when byte i of bytes is a command
+uint32_t bf_token_mask(__m128i bytes) {
+  __m128i found = _mm_cmpeq_epi8(bytes, _mm_set1_epi8('+'));
+  found = _mm_or_si128(found, _mm_cmpeq_epi8(bytes, _mm_set1_epi8('-')));
+  found = _mm_or_si128(found, _mm_cmpeq_epi8(bytes, _mm_set1_epi8('<')));
+  found = _mm_or_si128(found, _mm_cmpeq_epi8(bytes, _mm_set1_epi8('>')));
+  found = _mm_or_si128(found, _mm_cmpeq_epi8(bytes, _mm_set1_epi8('.')));
+  found = _mm_or_si128(found, _mm_cmpeq_epi8(bytes, _mm_set1_epi8(',')));
+  found = _mm_or_si128(found, _mm_cmpeq_epi8(bytes, _mm_set1_epi8('[')));
+  found = _mm_or_si128(found, _mm_cmpeq_epi8(bytes, _mm_set1_epi8(']')));
+  return _mm_movemask_epi8(found);
 }
 
-char lexer_next(Lexer *l, bool (*token_validator)(char)) {
-  while (l->pos < l->content.count && !token_validator(l->content.data[l->pos]))
-    l->pos++;
-  if (l->pos >= l->content.count)
+// returns the next command in the source or 0 at its end. Commands tend to
+// come in a row and are looked up one at a time, comments get skipped 16
+// bytes at a time.
+char lexer_next(Lexer *l) {
+  const char *data = l->content.data;
+  size_t count = l->content.count;
+  size_t pos = l->pos;
+  if (pos < count && bf_tokens[(unsigned char)data[pos]]) {
+    l->pos = pos + 1;
+    return data[pos];
+  }
+  for (; pos + 16 <= count; pos += 16) {
+    uint32_t found =
+        bf_token_mask(_mm_loadu_si128((const __m128i *)(data + pos)));
+    if (found) {
+      pos += __builtin_ctz(found);
+      l->pos = pos + 1;
+      return data[pos];
+    }
+  }
+  while (pos < count && !bf_tokens[(unsigned char)data[pos]])
+    pos++;
+  if (pos >= count) {
+    l->pos = count;
     return 0;
-  return l->content.data[l->pos++];
+  }
+  l->pos = pos + 1;
+  return data[pos];
 }
 
 typedef struct {
@@ -56,69 +135,1209 @@ typedef struct {
   size_t capacity;
 } Address_Stack;
 
-bool interpret(Program program, size_t memory_size) {
-  char *memory = calloc(memory_size, 1);
-  NOB_ASSERT(memory != NULL && "Buy More RAM LOL");
+// recomputes the targets of all jumps after a pass moved operators around
+void link_jumps(Program *program) {
+  Address_Stack address_stack = {0};
+  for (size_t i = 0; i < program->count; i++) {
+    Operator *op = program->items + i;
+    if (op->op_kind == OP_JMP_IF_ZERO) {
+      nob_da_append(&address_stack, i);
+    } else if (op->op_kind == OP_JMP_IF_NON_ZERO) {
+      size_t address = address_stack.items[--address_stack.count];
+      program->items[address].operand = i + 1;
+      op->operand = address + 1;
+    }
+  }
+  nob_da_free(address_stack);
+}
+
+// most threads parallel_for starts
+#define PARALLEL_MAX_THREADS 64
+
+size_t parallel_threads(void) {
+  long cores = sysconf(_SC_NPROCESSORS_ONLN);
+  if (cores < 1)
+    return 1;
+  return cores < PARALLEL_MAX_THREADS ? cores : PARALLEL_MAX_THREADS;
+}
+
+typedef struct {
+  void (*work)(void *context, size_t index);
+  void *context;
+  size_t count;
+  atomic_size_t next;
+} Parallel_For;
+
+void *parallel_worker(void *arg) {
+  Parallel_For *pf = arg;
+  for (;;) {
+    size_t index = atomic_fetch_add(&pf->next, 1);
+    if (index >= pf->count)
+      return NULL;
+    pf->work(pf->context, index);
+  }
+}
+
+// calls work for every index below count on up to threads threads, each of
+// them takes the next index that is left once it is done with one
+void parallel_for_threads(size_t threads, size_t count,
+                          void (*work)(void *context, size_t index),
+                          void *context) {
+  Parallel_For pf = {
+      .work = work,
+      .context = context,
+      .count = count,
+  };
+  if (threads > PARALLEL_MAX_THREADS)
+    threads = PARALLEL_MAX_THREADS;
+  if (threads > count)
+    threads = count;
+  pthread_t workers[PARALLEL_MAX_THREADS];
+  size_t started = 0;
+  // the calling thread is one of the workers, if no other one starts it does
+  // all of the work by itself
+  while (started + 1 < threads &&
+         !pthread_create(workers + started, NULL, parallel_worker, &pf))
+    started++;
+  parallel_worker(&pf);
+  for (size_t i = 0; i < started; i++)
+    pthread_join(workers[i], NULL);
+}
+
+// parallel_for_threads with a thread for every core
+void parallel_for(size_t count, void (*work)(void *context, size_t index),
+                  void *context) {
+  parallel_for_threads(parallel_threads(), count, work, context);
+}
+
+// what the time spent by a run of bf-jit went into, --stats prints it once
+// the run is over
+typedef enum {
+  PHASE_PARSE,   // reading and parsing the source
+  PHASE_COMPILE, // turning the program into bytecode or machine code
+  PHASE_RUN,     // running it, compiling done meanwhile included
+  COUNT_PHASES,
+} Phase;
+
+static const char *phase_names[COUNT_PHASES] = {
+    [PHASE_PARSE] = "parse",
+    [PHASE_COMPILE] = "compile",
+    [PHASE_RUN] = "run",
+};
+
+static struct {
+  Phase phase;
+  struct timespec entered;
+  double ms[COUNT_PHASES];
+} stats;
+
+// charges the time since the last phase change to that phase
+void stats_enter(Phase phase) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  stats.ms[stats.phase] += (now.tv_sec - stats.entered.tv_sec) * 1e3 +
+                           (now.tv_nsec - stats.entered.tv_nsec) / 1e6;
+  stats.phase = phase;
+  stats.entered = now;
+}
+
+void stats_print(void) {
+  stats_enter(stats.phase);
+  fprintf(stderr, "stats:");
+  for (Phase phase = 0; phase < COUNT_PHASES; phase++)
+    fprintf(stderr, " %s_ms=%.3f", phase_names[phase], stats.ms[phase]);
+  fprintf(stderr, "\n");
+}
+
+// size of the input and output buffers shared by the interpreter and the
+// compiled code
+#define RUNTIME_BUFFER_CAPACITY (64 * 1024)
+
+// what ',' stores in the current byte once the input has run out
+typedef enum {
+  EOF_LEAVE = 0, // keep the current byte as it is
+  EOF_ZERO = 1,
+  EOF_MINUS_ONE = 2,
+} Eof_Mode;
+
+// state the program needs besides its memory. The compiled code keeps a
+// pointer to it in r9 and addresses the fields with 8 bit displacements, so
+// the struct has to stay smaller than 128 bytes.
+typedef struct Runtime {
+  char *out_items;
+  size_t out_count;
+  int out_fd;
+  Eof_Mode eof_mode;
+  char *in_items;
+  size_t in_pos;
+  size_t in_count;
+  int in_fd;
+  size_t head; // position of the pointer when compiled code starts and stops
+  // callbacks of a library caller that take the place of in_fd and out_fd
+  const Bfjit_Io *io;
+  // lowest and highest head of the run so far, kept by code compiled with
+  // water_marks
+  size_t low_water;
+  size_t high_water;
+  // called by the compiled code instead of doing the syscalls itself when
+  // set, which they are only with io
+  int (*flush_hook)(struct Runtime *rt);  // returns an Exec_Status
+  int (*refill_hook)(struct Runtime *rt); // returns 0 on input, 1 at the end
+                                          // of it and 2 on an error
+} Runtime;
+
+_Static_assert(sizeof(Runtime) < 128,
+               "Runtime fields must be in reach of 8 bit displacements");
+
+// return values of the compiled code
+typedef enum {
+  EXEC_OK = 0,
+  EXEC_UNDERFLOW = 1,
+  EXEC_IO_ERROR = 2,
+  EXEC_OVERFLOW = 3,
+  EXEC_COMPILE_ERROR = 4, // a lazily compiled loop could not be compiled
+} Exec_Status;
+
+bool runtime_init(Runtime *rt, Eof_Mode eof_mode) {
+  memset(rt, 0, sizeof(*rt));
+  rt->out_items = malloc(RUNTIME_BUFFER_CAPACITY);
+  rt->out_fd = STDOUT_FILENO;
+  rt->eof_mode = eof_mode;
+  rt->in_items = malloc(RUNTIME_BUFFER_CAPACITY);
+  rt->in_fd = STDIN_FILENO;
+  return rt->out_items != NULL && rt->in_items != NULL;
+}
+
+void runtime_free(Runtime *rt) {
+  NOB_FREE(rt->out_items);
+  NOB_FREE(rt->in_items);
+}
+
+// hands the output buffer to the write callback of io, which drops it when
+// there is none, without logging an error as the compiled code reports it on
+// its own
+bool runtime_flush_io(Runtime *rt) {
+  if (rt->out_count && rt->io->write &&
+      !rt->io->write(rt->io->context, rt->out_items, rt->out_count))
+    return false;
+  rt->out_count = 0;
+  return true;
+}
+
+bool runtime_flush(Runtime *rt) {
+  if (rt->io) {
+    if (runtime_flush_io(rt))
+      return true;
+    nob_log(NOB_ERROR, "could not write output");
+    return false;
+  }
+  size_t written = 0;
+  while (written < rt->out_count) {
+    ssize_t n = write(rt->out_fd, rt->out_items + written,
+                      rt->out_count - written);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0) {
+      nob_log(NOB_ERROR, "could not write output: %s", str_err_no);
+      return false;
+    }
+    written += n;
+  }
+  rt->out_count = 0;
+  return true;
+}
+
+bool runtime_output(Runtime *rt, char byte, size_t count) {
+  while (count) {
+    if (rt->out_count == RUNTIME_BUFFER_CAPACITY && !runtime_flush(rt))
+      return false;
+    size_t n = RUNTIME_BUFFER_CAPACITY - rt->out_count;
+    if (n > count)
+      n = count;
+    memset(rt->out_items + rt->out_count, byte, n);
+    rt->out_count += n;
+    count -= n;
+  }
+  return true;
+}
+
+// replaces the input buffer with the next block of input. A read error counts
+// as end of input just like it does for the compiled code.
+void runtime_read(Runtime *rt) {
+  rt->in_pos = 0;
+  if (rt->io) {
+    rt->in_count = rt->io->read ? rt->io->read(rt->io->context, rt->in_items,
+                                               RUNTIME_BUFFER_CAPACITY)
+                                : 0;
+    return;
+  }
+  ssize_t n;
+  do {
+    n = read(rt->in_fd, rt->in_items, RUNTIME_BUFFER_CAPACITY);
+  } while (n < 0 && errno == EINTR);
+  rt->in_count = n > 0 ? n : 0;
+}
+
+// reads the next block of input, what was printed so far might be a prompt
+// for it so the output gets flushed first
+bool runtime_refill(Runtime *rt) {
+  if (!runtime_flush(rt))
+    return false;
+  runtime_read(rt);
+  return true;
+}
+
+int runtime_flush_hook(Runtime *rt) {
+  return runtime_flush_io(rt) ? EXEC_OK : EXEC_IO_ERROR;
+}
+
+int runtime_refill_hook(Runtime *rt) {
+  if (!runtime_flush_io(rt))
+    return 2;
+  runtime_read(rt);
+  return rt->in_count ? 0 : 1;
+}
+
+// stores value in the cell of cell_size bytes at cell, cut down to its width
+static inline void cell_store(char *cell, size_t cell_size, uint64_t value) {
+  switch (cell_size) {
+  case 1: {
+    uint8_t narrow = value;
+    memcpy(cell, &narrow, sizeof(narrow));
+  } break;
+  case 2: {
+    uint16_t narrow = value;
+    memcpy(cell, &narrow, sizeof(narrow));
+  } break;
+  case 4: {
+    uint32_t narrow = value;
+    memcpy(cell, &narrow, sizeof(narrow));
+  } break;
+  default:
+    memcpy(cell, &value, sizeof(value));
+  }
+}
+
+static inline uint64_t cell_load(const char *cell, size_t cell_size) {
+  switch (cell_size) {
+  case 1:
+    return (uint8_t)*cell;
+  case 2: {
+    uint16_t value;
+    memcpy(&value, cell, sizeof(value));
+    return value;
+  }
+  case 4: {
+    uint32_t value;
+    memcpy(&value, cell, sizeof(value));
+    return value;
+  }
+  default: {
+    uint64_t value;
+    memcpy(&value, cell, sizeof(value));
+    return value;
+  }
+  }
+}
+
+// reads count bytes into the cell, every one of them from 0 to 255
+bool runtime_input(Runtime *rt, char *cell, size_t cell_size, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    if (rt->in_pos == rt->in_count) {
+      if (!runtime_refill(rt))
+        return false;
+      if (!rt->in_count) {
+        if (rt->eof_mode != EOF_LEAVE)
+          cell_store(cell, cell_size, rt->eof_mode == EOF_ZERO ? 0 : -1);
+        continue;
+      }
+    }
+    cell_store(cell, cell_size, (uint8_t)rt->in_items[rt->in_pos++]);
+  }
+  return true;
+}
+
+// how the program gets run, shared by the interpreter and the compiled code
+typedef struct {
+  size_t memory_size; // in cells
+  size_t origin; // cell the pointer starts on, the ones left of it can be
+                 // reached with '<'
+  size_t cell_size; // bytes in a cell, 1, 2, 4 or 8
+  Eof_Mode eof_mode;
+  bool unchecked; // leave catching the program running off the tape to the
+                  // guard pages around it instead of checking every move
+  bool cache_cells; // keep bytes in registers within straight-line code
+  bool threaded;    // interpret packed bytecode with direct threading
+  bool lazy;        // compile top-level loops when they are first reached
+  bool water_marks; // keep the lowest and highest head in the Runtime
+  uint64_t *profile; // times the body of every loop ran, by the index of its
+                     // '[', counted only when set
+} Exec_Options;
+
+Exec_Options exec_options_default(void) {
+  return (Exec_Options){
+      .memory_size = 8 * 1024 * 1024 * 8,
+      .cell_size = 1,
+      .cache_cells = true,
+  };
+}
+
+// settles what the options chosen one by one mean together, bidirectional
+// puts the origin in the middle of the tape
+void exec_options_settle(Exec_Options *options, bool bidirectional) {
+  if (options->unchecked &&
+      options->memory_size * options->cell_size % sysconf(_SC_PAGESIZE)) {
+    // the guard pages have to start right where the tape ends
+    nob_log(NOB_WARNING, "tape size is not a multiple of the page size, "
+                         "checking bounds as usual");
+    options->unchecked = false;
+  }
+  if (bidirectional)
+    options->origin = options->memory_size / 2;
+}
+
+// the scans read whole aligned vectors around the pointer, so a tape with
+// checked bounds gets this much zeroed slack on both sides. A zero in there
+// stops a scan that ran off the tape which then reports the underflow or
+// overflow.
+#define TAPE_PADDING 64
+
+// the farthest in cells an operator may address from the pointer and a move
+// may go without a check of its own on a guarded tape. Keeps the offsets of
+// the widest cells in the range of a 32 bit displacement.
+#define RUN_MAX_OFFSET (1 << 27)
+
+// size of the inaccessible regions around an unchecked tape, more than any
+// move or offset can jump over
+#define TAPE_GUARD_SIZE ((size_t)1 << 32)
+
+typedef struct {
+  char *memory;
+  size_t size;   // in cells
+  size_t origin; // in cells
+  size_t cell_size;
+  bool guarded; // surrounded by guard pages instead of padding
+} Tape;
+
+size_t tape_bytes(const Tape *tape) { return tape->size * tape->cell_size; }
+
+// the tape is only reserved, its pages get committed and zeroed by the kernel
+// when the program first touches them. Most programs use a few pages of it no
+// matter how big it is. A guarded tape starts and ends on a page boundary so
+// the guard pages begin right where the tape does, memory_size has to be a
+// multiple of the page size.
+bool tape_alloc(Tape *tape, Exec_Options options) {
+  size_t memory_size = options.memory_size * options.cell_size;
+  tape->size = options.memory_size;
+  tape->origin = options.origin;
+  tape->cell_size = options.cell_size;
+  tape->guarded = options.unchecked;
+  if (!tape->guarded) {
+    char *base = mmap(NULL, memory_size + 2 * TAPE_PADDING,
+                      PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    tape->memory = base == MAP_FAILED ? NULL : base + TAPE_PADDING;
+    return tape->memory != NULL;
+  }
+  size_t len = memory_size + 2 * TAPE_GUARD_SIZE;
+  char *base = mmap(NULL, len, PROT_NONE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  if (base == MAP_FAILED) {
+    tape->memory = NULL;
+    return false;
+  }
+  tape->memory = base + TAPE_GUARD_SIZE;
+  if (mprotect(tape->memory, memory_size, PROT_READ | PROT_WRITE) < 0) {
+    munmap(base, len);
+    tape->memory = NULL;
+    return false;
+  }
+  return true;
+}
+
+void tape_free(Tape tape) {
+  if (!tape.memory)
+    return;
+  if (tape.guarded)
+    munmap(tape.memory - TAPE_GUARD_SIZE,
+           tape_bytes(&tape) + 2 * TAPE_GUARD_SIZE);
+  else
+    munmap(tape.memory - TAPE_PADDING, tape_bytes(&tape) + 2 * TAPE_PADDING);
+}
+
+// up to how many bytes of a tape get zeroed in place after a run, more than
+// that are dropped and given back to the system
+#define TAPE_RESET_MEMSET_LIMIT (256 * 1024)
+
+// zeroes the cells from low to high a run may have written to. Dropping pages
+// makes the next run fault them in again, so only big ranges are dropped.
+void tape_reset(Tape *tape, size_t low, size_t high) {
+  if (high > tape->size)
+    high = tape->size;
+  if (low >= high)
+    return;
+  char *begin = tape->memory + low * tape->cell_size;
+  char *end = tape->memory + high * tape->cell_size;
+  if ((size_t)(end - begin) <= TAPE_RESET_MEMSET_LIMIT) {
+    memset(begin, 0, end - begin);
+    return;
+  }
+  // the pages at both ends are zero outside of the range anyway, only the
+  // padding before a checked tape shares the first page with it
+  uintptr_t page_size = sysconf(_SC_PAGESIZE);
+  uintptr_t first = (uintptr_t)begin & ~(page_size - 1);
+  madvise((void *)first, (uintptr_t)end - first, MADV_DONTNEED);
+}
+
+// values sigsetjmp returns with once a program touched a guard page
+typedef enum {
+  GUARD_UNDERFLOW = 1,
+  GUARD_OVERFLOW = 2,
+} Guard_Fault;
+
+// the guarded tape the current thread runs a program on and where to go when
+// the program touches its guard pages
+static _Thread_local Tape *guarded_tape;
+static _Thread_local sigjmp_buf guard_fault;
+
+// the handler belongs to the whole process, it stays installed while any
+// thread runs on a guarded tape
+static struct {
+  pthread_mutex_t lock;
+  size_t users;
+  struct sigaction previous;
+} guard = {.lock = PTHREAD_MUTEX_INITIALIZER};
+
+void guard_handler(int sig, siginfo_t *info, void *context) {
+  (void)context;
+  const char *address = info->si_addr;
+  const Tape *tape = guarded_tape;
+  if (tape && address < tape->memory &&
+      address >= tape->memory - TAPE_GUARD_SIZE)
+    siglongjmp(guard_fault, GUARD_UNDERFLOW);
+  if (tape && address >= tape->memory + tape_bytes(tape) &&
+      address < tape->memory + tape_bytes(tape) + TAPE_GUARD_SIZE)
+    siglongjmp(guard_fault, GUARD_OVERFLOW);
+  // not a fault of the program, crash like it would have without the handler
+  signal(sig, SIG_DFL);
+}
+
+// routes faults in the guard pages of the tape to guard_fault, which the
+// caller has to set up with sigsetjmp before running the program
+bool guard_begin(Tape *tape) {
+  pthread_mutex_lock(&guard.lock);
+  if (!guard.users) {
+    struct sigaction action = {0};
+    action.sa_sigaction = guard_handler;
+    action.sa_flags = SA_SIGINFO;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(SIGSEGV, &action, &guard.previous) < 0) {
+      pthread_mutex_unlock(&guard.lock);
+      nob_log(NOB_ERROR, "could not install the guard page handler: %s",
+              str_err_no);
+      return false;
+    }
+  }
+  guard.users++;
+  pthread_mutex_unlock(&guard.lock);
+  guarded_tape = tape;
+  return true;
+}
+
+// only for a guard_begin that succeeded
+void guard_end(void) {
+  guarded_tape = NULL;
+  pthread_mutex_lock(&guard.lock);
+  if (!--guard.users)
+    sigaction(SIGSEGV, &guard.previous, NULL);
+  pthread_mutex_unlock(&guard.lock);
+}
+
+// bit mask of the lanes a scan of the given stride looks at in a vector of
+// width bytes, starting with lane 0
+uint32_t scan_lane_mask(size_t stride, size_t width) {
+  uint32_t mask = 0;
+  for (size_t i = 0; i < width; i += stride)
+    mask |= 1u << i;
+  return mask;
+}
+
+// sets all bytes of the cells in the vector that are zero, SSE2 has no
+// compare for 64 bit lanes so those cells are never scanned a vector at a time
+static inline __m128i zero_cells(__m128i cells, size_t cell_size) {
+  __m128i zero = _mm_setzero_si128();
+  switch (cell_size) {
+  case 1:
+    return _mm_cmpeq_epi8(cells, zero);
+  case 2:
+    return _mm_cmpeq_epi16(cells, zero);
+  default:
+    return _mm_cmpeq_epi32(cells, zero);
+  }
+}
+
+// returns the position of the first zero cell at head, head + stride, ...
+// or memory_size if the scan runs off the tape. The vector scans only load
+// whole aligned vectors, those never reach past the page of a cell of the
+// tape and so stay clear of the guard pages until the scan really runs off
+// it. The lanes a multiple of the stride away from the pointer are the same in
+// every vector, the first one leaves out the lanes on the wrong side of the
+// pointer. A zero cell sets all of its lanes, the first of them is the one
+// that counts.
+size_t scan_right(const char *memory, size_t memory_size, size_t head,
+                  size_t stride, size_t cell_size) {
+  if (stride == 1 && cell_size == 1) {
+    const char *zero = memchr(memory + head, 0, memory_size - head);
+    return zero ? (size_t)(zero - memory) : memory_size;
+  }
+  size_t step = stride * cell_size;
+  if (cell_size <= 4 && 16 % step == 0) {
+    size_t misalignment = (uintptr_t)(memory + head * cell_size) % 16;
+    const char *vector = memory + head * cell_size - misalignment;
+    uint32_t lanes = scan_lane_mask(step, 16) << misalignment % step;
+    uint32_t mask = lanes & (0xffffu << misalignment);
+    for (;;) {
+      __m128i cells = _mm_load_si128((const __m128i *)vector);
+      uint32_t found = _mm_movemask_epi8(zero_cells(cells, cell_size)) & mask;
+      if (found) {
+        size_t position =
+            (vector - memory + __builtin_ctz(found)) / cell_size;
+        return position < memory_size ? position : memory_size;
+      }
+      mask = lanes;
+      vector += 16;
+    }
+  }
+  while (head < memory_size &&
+         cell_load(memory + head * cell_size, cell_size))
+    head += stride;
+  return head < memory_size ? head : memory_size;
+}
+
+// returns the position of the first zero cell at head, head - stride, ...
+// or SIZE_MAX if the scan runs off the tape
+size_t scan_left(const char *memory, size_t head, size_t stride,
+                 size_t cell_size) {
+  if (stride == 1 && cell_size == 1) {
+    const char *zero = memrchr(memory, 0, head + 1);
+    return zero ? (size_t)(zero - memory) : SIZE_MAX;
+  }
+  size_t step = stride * cell_size;
+  if (cell_size <= 4 && 16 % step == 0) {
+    size_t misalignment = (uintptr_t)(memory + head * cell_size) % 16;
+    const char *vector = memory + head * cell_size - misalignment;
+    uint32_t lanes = scan_lane_mask(step, 16) << misalignment % step;
+    uint32_t mask = lanes & ((2u << misalignment) - 1);
+    for (;;) {
+      __m128i cells = _mm_load_si128((const __m128i *)vector);
+      uint32_t found = _mm_movemask_epi8(zero_cells(cells, cell_size)) & mask;
+      if (found) {
+        ptrdiff_t position = vector - memory + (31 - __builtin_clz(found));
+        return position < 0 ? SIZE_MAX : (size_t)position / cell_size;
+      }
+      mask = lanes;
+      vector -= 16;
+    }
+  }
+  while (cell_load(memory + head * cell_size, cell_size)) {
+    if (head < stride)
+      return SIZE_MAX;
+    head -= stride;
+  }
+  return head;
+}
+
+// logs what went wrong in compiled code, returns whether it went fine
+bool report_exec_status(Exec_Status status) {
+  switch (status) {
+  case EXEC_OK:
+    return true;
+  case EXEC_UNDERFLOW:
+    nob_log(NOB_ERROR, "Memory Underflow");
+    return false;
+  case EXEC_OVERFLOW:
+    nob_log(NOB_ERROR, "Memory Overflow");
+    return false;
+  case EXEC_IO_ERROR:
+    nob_log(NOB_ERROR, "could not write output");
+    return false;
+  case EXEC_COMPILE_ERROR:
+    // lazy_compile already told why
+    return false;
+  default:
+    NOB_ASSERT(0 && "Unreachable");
+    return false;
+  }
+}
+
+// the loops of a program run by the tiered interpreter, they get compiled in
+// the background once they are hot. Defined next to the compiler.
+typedef struct Tiers Tiers;
+bool tier_run(Tiers *tiers, size_t start, bool back_edge, char *memory,
+              size_t *head, Runtime *rt, Exec_Status *status);
+
+// runs the program on the tape, a guarded tape leaves the bounds checks to
+// its guard pages. With tiers the loops that got compiled run as machine code,
+// starting at the next time the interpreter enters them or goes back to their
+// start. With profile every run of a loop body is counted there. Defined once
+// for every cell width so the cells are read and written as they are.
+#define DEFINE_INTERPRET_TAPE(bits)                                            \
+bool interpret_tape_##bits(Program program, Tape tape, Runtime *rt,            \
+                           Tiers *tiers, uint64_t *profile) {                  \
+  bool result = true;                                                          \
+  uint##bits##_t *memory = (uint##bits##_t *)tape.memory;                      \
+  size_t memory_size = tape.size;                                              \
+  bool checked = !tape.guarded;                                                \
+                                                                               \
+  size_t head = tape.origin;                                                   \
+  size_t ip = 0;                                                               \
+  while (ip < program.count) {                                                 \
+    Operator *op = program.items + ip;                                         \
+    switch (op->op_kind) {                                                     \
+    case OP_INC: {                                                             \
+      memory[head + op->offset] += op->operand;                                \
+      ip++;                                                                    \
+    } break;                                                                   \
+    case OP_DEC: {                                                             \
+      memory[head + op->offset] -= op->operand;                                \
+      ip++;                                                                    \
+    } break;                                                                   \
+    case OP_LEFT: {                                                            \
+      if (checked && head < op->operand) {                                     \
+        nob_log(NOB_ERROR, "Memory Underflow");                                \
+        nob_return_defer(false);                                               \
+      }                                                                        \
+      head -= op->operand;                                                     \
+      ip++;                                                                    \
+    } break;                                                                   \
+    case OP_RIGHT: {                                                           \
+      head += op->operand;                                                     \
+      if (checked && head >= memory_size) {                                    \
+        nob_log(NOB_ERROR, "Memory Overflow");                                 \
+        nob_return_defer(false);                                               \
+      }                                                                        \
+      ip++;                                                                    \
+    } break;                                                                   \
+    case OP_CHECK: {                                                           \
+      if (!checked) {                                                          \
+        ip++;                                                                  \
+        break;                                                                 \
+      }                                                                        \
+      if (head < (size_t)-op->offset) {                                        \
+        nob_log(NOB_ERROR, "Memory Underflow");                                \
+        nob_return_defer(false);                                               \
+      }                                                                        \
+      if (head + op->operand >= memory_size) {                                 \
+        nob_log(NOB_ERROR, "Memory Overflow");                                 \
+        nob_return_defer(false);                                               \
+      }                                                                        \
+      ip++;                                                                    \
+    } break;                                                                   \
+    case OP_INPUT: {                                                           \
+      if (!runtime_input(rt, (char *)(memory + head + op->offset),             \
+                         sizeof(*memory), op->operand))                        \
+        nob_return_defer(false);                                               \
+      ip++;                                                                    \
+    } break;                                                                   \
+    case OP_OUTPUT: {                                                          \
+      if (!runtime_output(rt, memory[head + op->offset], op->operand))         \
+        nob_return_defer(false);                                               \
+      ip++;                                                                    \
+    } break;                                                                   \
+    case OP_SET: {                                                             \
+      memory[head + op->offset] = op->operand;                                 \
+      ip++;                                                                    \
+    } break;                                                                   \
+    case OP_MUL: {                                                             \
+      if (memory[head + op->source]) {                                         \
+        if (checked && op->offset < 0 && head < (size_t)-op->offset) {         \
+          nob_log(NOB_ERROR, "Memory Underflow");                              \
+          nob_return_defer(false);                                             \
+        }                                                                      \
+        if (checked && head + op->offset >= memory_size) {                     \
+          nob_log(NOB_ERROR, "Memory Overflow");                               \
+          nob_return_defer(false);                                             \
+        }                                                                      \
+        memory[head + op->offset] +=                                           \
+            (uint64_t)memory[head + op->source] * op->operand;                 \
+      }                                                                        \
+      ip++;                                                                    \
+    } break;                                                                   \
+    case OP_SCAN_LEFT: {                                                       \
+      head = scan_left(tape.memory, head, op->operand, sizeof(*memory));       \
+      if (head == SIZE_MAX) {                                                  \
+        nob_log(NOB_ERROR, "Memory Underflow");                                \
+        nob_return_defer(false);                                               \
+      }                                                                        \
+      ip++;                                                                    \
+    } break;                                                                   \
+    case OP_SCAN_RIGHT: {                                                      \
+      head = scan_right(tape.memory, memory_size, head, op->operand,           \
+                        sizeof(*memory));                                      \
+      if (head == memory_size) {                                               \
+        nob_log(NOB_ERROR, "Memory Overflow");                                 \
+        nob_return_defer(false);                                               \
+      }                                                                        \
+      ip++;                                                                    \
+    } break;                                                                   \
+    case OP_JMP_IF_ZERO: {                                                     \
+      Exec_Status status;                                                      \
+      if (tiers &&                                                             \
+          tier_run(tiers, ip, false, tape.memory, &head, rt, &status)) {       \
+        if (!report_exec_status(status))                                       \
+          nob_return_defer(false);                                             \
+        ip = op->operand;                                                      \
+        break;                                                                 \
+      }                                                                        \
+      if (!memory[head]) {                                                     \
+        ip = op->operand;                                                      \
+        break;                                                                 \
+      }                                                                        \
+      if (profile)                                                             \
+        profile[ip]++;                                                         \
+      ip++;                                                                    \
+    } break;                                                                   \
+    case OP_JMP_IF_NON_ZERO: {                                                 \
+      Exec_Status status;                                                      \
+      size_t start = op->operand - 1;                                          \
+      if (memory[head] && tiers &&                                             \
+          tier_run(tiers, start, true, tape.memory, &head, rt, &status)) {     \
+        if (!report_exec_status(status))                                       \
+          nob_return_defer(false);                                             \
+        ip = program.items[start].operand;                                     \
+        break;                                                                 \
+      }                                                                        \
+      if (!memory[head]) {                                                     \
+        ip++;                                                                  \
+        break;                                                                 \
+      }                                                                        \
+      if (profile)                                                             \
+        profile[start]++;                                                      \
+      ip = op->operand;                                                        \
+    } break;                                                                   \
+    default:                                                                   \
+      NOB_ASSERT(0 && "unreachable");                                          \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+defer:                                                                         \
+  return result;                                                               \
+}
+DEFINE_INTERPRET_TAPE(8)
+DEFINE_INTERPRET_TAPE(16)
+DEFINE_INTERPRET_TAPE(32)
+DEFINE_INTERPRET_TAPE(64)
+#undef DEFINE_INTERPRET_TAPE
+
+bool interpret_tape(Program program, Tape tape, Runtime *rt, Tiers *tiers,
+                    uint64_t *profile) {
+  switch (tape.cell_size) {
+  case 1:
+    return interpret_tape_8(program, tape, rt, tiers, profile);
+  case 2:
+    return interpret_tape_16(program, tape, rt, tiers, profile);
+  case 4:
+    return interpret_tape_32(program, tape, rt, tiers, profile);
+  default:
+    return interpret_tape_64(program, tape, rt, tiers, profile);
+  }
+}
+
+// instructions of the threaded interpreter, the opcode is followed by the
+// operands listed, every one of them is a 32 bit word
+typedef enum {
+  BC_ADD,             // offset, value
+  BC_SET,             // offset, value
+  BC_MOVE,            // distance
+  BC_MOVE_UNCHECKED,  // distance
+  BC_CHECK,           // low, high
+  BC_INPUT,           // offset, count
+  BC_OUTPUT,          // offset, count
+  BC_MUL,             // offset, source, factor
+  BC_MUL_UNCHECKED,   // offset, source, factor
+  BC_SCAN_LEFT,       // stride
+  BC_SCAN_RIGHT,      // stride
+  BC_JMP_IF_ZERO,     // target
+  BC_JMP_IF_NON_ZERO, // target
+  BC_JMP_IF_ZERO_COUNTED,     // target, loop
+  BC_JMP_IF_NON_ZERO_COUNTED, // target, loop
+  BC_END,
+  COUNT_BC_OPS,
+} Bytecode_Op;
+
+// number of words of each instruction, its opcode included
+static const size_t bytecode_op_size[COUNT_BC_OPS] = {
+    [BC_ADD] = 3,
+    [BC_SET] = 3,
+    [BC_MOVE] = 2,
+    [BC_MOVE_UNCHECKED] = 2,
+    [BC_CHECK] = 3,
+    [BC_INPUT] = 3,
+    [BC_OUTPUT] = 3,
+    [BC_MUL] = 4,
+    [BC_MUL_UNCHECKED] = 4,
+    [BC_SCAN_LEFT] = 2,
+    [BC_SCAN_RIGHT] = 2,
+    [BC_JMP_IF_ZERO] = 2,
+    [BC_JMP_IF_NON_ZERO] = 2,
+    [BC_JMP_IF_ZERO_COUNTED] = 3,
+    [BC_JMP_IF_NON_ZERO_COUNTED] = 3,
+    [BC_END] = 1,
+};
+
+typedef struct {
+  int32_t *items;
+  size_t count;
+  size_t capacity;
+  bool threaded; // the opcodes have been replaced by the distance of their
+                 // handler in interpret_bytecode from its first one
+} Bytecode;
+
+void bytecode_append(Bytecode *bytecode, Bytecode_Op op, int32_t a, int32_t b,
+                     int32_t c) {
+  int32_t words[] = {op, a, b, c};
+  size_t size = bytecode_op_size[op];
+  nob_da_append_many(bytecode, words, size);
+}
+
+// takes the next word of value off it, value is a number of cell_size bytes
+// and the words add up to it with their signs
+int32_t bytecode_value_chunk(uint64_t *value, size_t cell_size) {
+  int shift = 64 - 8 * cell_size;
+  int64_t left = (int64_t)(*value << shift) >> shift;
+  int32_t chunk = left < INT32_MIN   ? INT32_MIN
+                  : left > INT32_MAX ? INT32_MAX
+                                     : left;
+  *value -= chunk;
+  return chunk;
+}
+
+// whether there is anything left of value in a cell of cell_size bytes
+bool bytecode_value_left(uint64_t value, size_t cell_size) {
+  return value << (64 - 8 * cell_size);
+}
 
-  size_t head = 0;
-  size_t ip = 0;
-  while (ip < program.count) {
-    Operator *op = program.items + ip;
+// packs the program into bytecode, jumps target the word their instruction
+// starts at. Operands too big for a word are split over several instructions,
+// a guarded tape leaves out the checks its guard pages make. Counted jumps
+// also name the '[' of their loop for the profile.
+void program_to_bytecode(Program program, bool checked, bool counted,
+                         size_t cell_size, Bytecode *bytecode) {
+  Address_Stack addresses = {0};
+  for (size_t i = 0; i < program.count; i++) {
+    Operator *op = program.items + i;
+    nob_da_append(&addresses, bytecode->count);
     switch (op->op_kind) {
-    case OP_INC: {
-      memory[head] += op->operand & 0xff;
-      ip++;
-    } break;
+    case OP_INC:
     case OP_DEC: {
-      memory[head] -= op->operand & 0xff;
-      ip++;
+      uint64_t value = op->op_kind == OP_INC ? op->operand : -op->operand;
+      do {
+        int32_t chunk = bytecode_value_chunk(&value, cell_size);
+        bytecode_append(bytecode, BC_ADD, op->offset, chunk, 0);
+      } while (bytecode_value_left(value, cell_size));
     } break;
-    case OP_LEFT: {
-      if (head < op->operand) {
-        nob_log(NOB_ERROR, "Memory Underflow");
-        NOB_FREE(memory);
-        return false;
+    case OP_SET: {
+      uint64_t value = op->operand;
+      int32_t chunk = bytecode_value_chunk(&value, cell_size);
+      bytecode_append(bytecode, BC_SET, op->offset, chunk, 0);
+      while (bytecode_value_left(value, cell_size)) {
+        chunk = bytecode_value_chunk(&value, cell_size);
+        bytecode_append(bytecode, BC_ADD, op->offset, chunk, 0);
       }
-      head -= op->operand;
-      ip++;
     } break;
+    case OP_LEFT:
     case OP_RIGHT: {
-      head += op->operand;
-      if (head >= memory_size) {
-        nob_log(NOB_ERROR, "Memory Overflow");
-        NOB_FREE(memory);
-        return false;
+      // the guard pages only catch moves that can't jump over them
+      Bytecode_Op move = checked || op->operand > RUN_MAX_OFFSET
+                             ? BC_MOVE
+                             : BC_MOVE_UNCHECKED;
+      for (size_t left = op->operand; left;) {
+        int32_t chunk = left < INT32_MAX ? left : INT32_MAX;
+        left -= chunk;
+        bytecode_append(bytecode, move,
+                        op->op_kind == OP_LEFT ? -chunk : chunk, 0, 0);
       }
-      ip++;
     } break;
-    case OP_INPUT: {
-      for (size_t i = 0; i < op->operand; i++) {
-        fread(memory + head, 1, 1, stdin);
-      }
-      ip++;
+    case OP_CHECK: {
+      if (checked)
+        bytecode_append(bytecode, BC_CHECK, op->offset, op->operand, 0);
     } break;
+    case OP_INPUT:
     case OP_OUTPUT: {
-      for (size_t i = 0; i < op->operand; i++) {
-        fwrite(memory + head, 1, 1, stdout);
+      Bytecode_Op io = op->op_kind == OP_INPUT ? BC_INPUT : BC_OUTPUT;
+      for (size_t left = op->operand; left;) {
+        int32_t chunk = left < INT32_MAX ? left : INT32_MAX;
+        left -= chunk;
+        bytecode_append(bytecode, io, op->offset, chunk, 0);
       }
-      ip++;
+    } break;
+    case OP_MUL: {
+      uint64_t factor = op->operand;
+      do {
+        int32_t chunk = bytecode_value_chunk(&factor, cell_size);
+        bytecode_append(bytecode, checked ? BC_MUL : BC_MUL_UNCHECKED,
+                        op->offset, op->source, chunk);
+      } while (bytecode_value_left(factor, cell_size));
+    } break;
+    case OP_SCAN_LEFT:
+    case OP_SCAN_RIGHT: {
+      bytecode_append(bytecode,
+                      op->op_kind == OP_SCAN_LEFT ? BC_SCAN_LEFT
+                                                  : BC_SCAN_RIGHT,
+                      op->operand, 0, 0);
     } break;
     case OP_JMP_IF_ZERO: {
-      ip = memory[head] ? (ip + 1) : (op->operand);
+      // the target is filled in once all addresses are known
+      bytecode_append(bytecode,
+                      counted ? BC_JMP_IF_ZERO_COUNTED : BC_JMP_IF_ZERO, 0, i,
+                      0);
     } break;
     case OP_JMP_IF_NON_ZERO: {
-      ip = memory[head] ? (op->operand) : (ip + 1);
+      bytecode_append(bytecode,
+                      counted ? BC_JMP_IF_NON_ZERO_COUNTED
+                              : BC_JMP_IF_NON_ZERO,
+                      0, op->operand - 1, 0);
     } break;
     default:
-      NOB_ASSERT(0 && "unreachable");
+      NOB_ASSERT(0 && "Unreachable");
     }
   }
-  NOB_FREE(memory);
-  return true;
+  nob_da_append(&addresses, bytecode->count);
+  bytecode_append(bytecode, BC_END, 0, 0, 0);
+
+  for (size_t i = 0; i < program.count; i++) {
+    Operator *op = program.items + i;
+    if (op->op_kind == OP_JMP_IF_ZERO || op->op_kind == OP_JMP_IF_NON_ZERO)
+      bytecode->items[addresses.items[i] + 1] = addresses.items[op->operand];
+  }
+  nob_da_free(addresses);
+}
+
+// moves on to the instruction size words further, see interpret_bytecode
+#define DISPATCH(size)                                                         \
+  do {                                                                         \
+    ip += (size);                                                              \
+    goto *((const char *)&&op_add + *ip);                                      \
+  } while (0)
+
+// runs the bytecode with direct threading, every handler jumps straight to
+// the handler of the next instruction instead of going back to a shared
+// switch. The first run replaces the opcodes by the distance of their handler
+// from the first one which keeps the words at 32 bits, those distances only
+// hold for the cell width of that run. Counted jumps add the runs of their
+// loop bodies to profile.
+#define DEFINE_INTERPRET_BYTECODE(bits)                                        \
+bool interpret_bytecode_##bits(Bytecode *bytecode, Tape tape, Runtime *rt,     \
+                               uint64_t *profile) {                            \
+  static const void *const handlers[COUNT_BC_OPS] = {                          \
+      [BC_ADD] = &&op_add,                                                     \
+      [BC_SET] = &&op_set,                                                     \
+      [BC_MOVE] = &&op_move,                                                   \
+      [BC_MOVE_UNCHECKED] = &&op_move_unchecked,                               \
+      [BC_CHECK] = &&op_check,                                                 \
+      [BC_INPUT] = &&op_input,                                                 \
+      [BC_OUTPUT] = &&op_output,                                               \
+      [BC_MUL] = &&op_mul,                                                     \
+      [BC_MUL_UNCHECKED] = &&op_mul_unchecked,                                 \
+      [BC_SCAN_LEFT] = &&op_scan_left,                                         \
+      [BC_SCAN_RIGHT] = &&op_scan_right,                                       \
+      [BC_JMP_IF_ZERO] = &&op_jmp_if_zero,                                     \
+      [BC_JMP_IF_NON_ZERO] = &&op_jmp_if_non_zero,                             \
+      [BC_JMP_IF_ZERO_COUNTED] = &&op_jmp_if_zero_counted,                     \
+      [BC_JMP_IF_NON_ZERO_COUNTED] = &&op_jmp_if_non_zero_counted,             \
+      [BC_END] = &&op_end,                                                     \
+  };                                                                           \
+  if (!bytecode->threaded) {                                                   \
+    for (size_t i = 0; i < bytecode->count;) {                                 \
+      Bytecode_Op op = bytecode->items[i];                                     \
+      bytecode->items[i] =                                                     \
+          (const char *)handlers[op] - (const char *)&&op_add;                 \
+      i += bytecode_op_size[op];                                               \
+    }                                                                          \
+    bytecode->threaded = true;                                                 \
+  }                                                                            \
+                                                                               \
+  bool result = true;                                                          \
+  uint##bits##_t *memory = (uint##bits##_t *)tape.memory;                      \
+  size_t memory_size = tape.size;                                              \
+  const int32_t *code = bytecode->items;                                       \
+  const int32_t *ip = code;                                                    \
+  size_t head = tape.origin;                                                   \
+                                                                               \
+  DISPATCH(0);                                                                 \
+                                                                               \
+op_add:                                                                        \
+  memory[head + ip[1]] += ip[2];                                               \
+  DISPATCH(3);                                                                 \
+op_set:                                                                        \
+  memory[head + ip[1]] = ip[2];                                                \
+  DISPATCH(3);                                                                 \
+op_move:                                                                       \
+  if (ip[1] < 0 && head < (size_t)-(ptrdiff_t)ip[1]) {                         \
+    nob_log(NOB_ERROR, "Memory Underflow");                                    \
+    nob_return_defer(false);                                                   \
+  }                                                                            \
+  head += ip[1];                                                               \
+  if (head >= memory_size) {                                                   \
+    nob_log(NOB_ERROR, "Memory Overflow");                                     \
+    nob_return_defer(false);                                                   \
+  }                                                                            \
+  DISPATCH(2);                                                                 \
+op_move_unchecked:                                                             \
+  head += ip[1];                                                               \
+  DISPATCH(2);                                                                 \
+op_check:                                                                      \
+  if (head < (size_t)-(ptrdiff_t)ip[1]) {                                      \
+    nob_log(NOB_ERROR, "Memory Underflow");                                    \
+    nob_return_defer(false);                                                   \
+  }                                                                            \
+  if (head + ip[2] >= memory_size) {                                           \
+    nob_log(NOB_ERROR, "Memory Overflow");                                     \
+    nob_return_defer(false);                                                   \
+  }                                                                            \
+  DISPATCH(3);                                                                 \
+op_input:                                                                      \
+  if (!runtime_input(rt, (char *)(memory + head + ip[1]), sizeof(*memory),     \
+                     ip[2]))                                                   \
+    nob_return_defer(false);                                                   \
+  DISPATCH(3);                                                                 \
+op_output:                                                                     \
+  if (!runtime_output(rt, memory[head + ip[1]], ip[2]))                        \
+    nob_return_defer(false);                                                   \
+  DISPATCH(3);                                                                 \
+op_mul:                                                                        \
+  if (memory[head + ip[2]]) {                                                  \
+    if (ip[1] < 0 && head < (size_t)-(ptrdiff_t)ip[1]) {                       \
+      nob_log(NOB_ERROR, "Memory Underflow");                                  \
+      nob_return_defer(false);                                                 \
+    }                                                                          \
+    if (head + ip[1] >= memory_size) {                                         \
+      nob_log(NOB_ERROR, "Memory Overflow");                                   \
+      nob_return_defer(false);                                                 \
+    }                                                                          \
+    memory[head + ip[1]] += (uint64_t)memory[head + ip[2]] * ip[3];            \
+  }                                                                            \
+  DISPATCH(4);                                                                 \
+op_mul_unchecked:                                                              \
+  if (memory[head + ip[2]])                                                    \
+    memory[head + ip[1]] += (uint64_t)memory[head + ip[2]] * ip[3];            \
+  DISPATCH(4);                                                                 \
+op_scan_left:                                                                  \
+  head = scan_left(tape.memory, head, ip[1], sizeof(*memory));                 \
+  if (head == SIZE_MAX) {                                                      \
+    nob_log(NOB_ERROR, "Memory Underflow");                                    \
+    nob_return_defer(false);                                                   \
+  }                                                                            \
+  DISPATCH(2);                                                                 \
+op_scan_right:                                                                 \
+  head = scan_right(tape.memory, memory_size, head, ip[1], sizeof(*memory));   \
+  if (head == memory_size) {                                                   \
+    nob_log(NOB_ERROR, "Memory Overflow");                                     \
+    nob_return_defer(false);                                                   \
+  }                                                                            \
+  DISPATCH(2);                                                                 \
+op_jmp_if_zero:                                                                \
+  if (memory[head])                                                            \
+    DISPATCH(2);                                                               \
+  ip = code + ip[1];                                                           \
+  DISPATCH(0);                                                                 \
+op_jmp_if_non_zero:                                                            \
+  if (!memory[head])                                                           \
+    DISPATCH(2);                                                               \
+  ip = code + ip[1];                                                           \
+  DISPATCH(0);                                                                 \
+op_jmp_if_zero_counted:                                                        \
+  if (!memory[head]) {                                                         \
+    ip = code + ip[1];                                                         \
+    DISPATCH(0);                                                               \
+  }                                                                            \
+  profile[ip[2]]++;                                                            \
+  DISPATCH(3);                                                                 \
+op_jmp_if_non_zero_counted:                                                    \
+  if (!memory[head])                                                           \
+    DISPATCH(3);                                                               \
+  profile[ip[2]]++;                                                            \
+  ip = code + ip[1];                                                           \
+  DISPATCH(0);                                                                 \
+op_end:                                                                        \
+                                                                               \
+defer:                                                                         \
+  return result;                                                               \
+}
+DEFINE_INTERPRET_BYTECODE(8)
+DEFINE_INTERPRET_BYTECODE(16)
+DEFINE_INTERPRET_BYTECODE(32)
+DEFINE_INTERPRET_BYTECODE(64)
+#undef DEFINE_INTERPRET_BYTECODE
+#undef DISPATCH
+
+bool interpret_bytecode(Bytecode *bytecode, Tape tape, Runtime *rt,
+                        uint64_t *profile) {
+  switch (tape.cell_size) {
+  case 1:
+    return interpret_bytecode_8(bytecode, tape, rt, profile);
+  case 2:
+    return interpret_bytecode_16(bytecode, tape, rt, profile);
+  case 4:
+    return interpret_bytecode_32(bytecode, tape, rt, profile);
+  default:
+    return interpret_bytecode_64(bytecode, tape, rt, profile);
+  }
+}
+
+bool interpret(Program program, Exec_Options options, Tiers *tiers) {
+  bool result = true;
+  Runtime rt = {0};
+  Tape tape = {0};
+  Bytecode bytecode = {0};
+  volatile bool guarded = false;
+  stats_enter(PHASE_COMPILE);
+  if (options.threaded)
+    program_to_bytecode(program, !options.unchecked, options.profile != NULL,
+                        options.cell_size, &bytecode);
+  stats_enter(PHASE_RUN);
+  if (!tape_alloc(&tape, options)) {
+    nob_log(NOB_ERROR, "could not allocate a tape of %zu bytes: %s",
+            options.memory_size * options.cell_size, str_err_no);
+    nob_return_defer(false);
+  }
+  if (!runtime_init(&rt, options.eof_mode)) {
+    nob_log(NOB_ERROR, "could not allocate the I/O buffers: %s", str_err_no);
+    nob_return_defer(false);
+  }
+  if (tape.guarded) {
+    if (!guard_begin(&tape))
+      nob_return_defer(false);
+    guarded = true;
+    switch (sigsetjmp(guard_fault, 1)) {
+    case 0:
+      break;
+    case GUARD_UNDERFLOW:
+      nob_log(NOB_ERROR, "Memory Underflow");
+      nob_return_defer(false);
+    case GUARD_OVERFLOW:
+      nob_log(NOB_ERROR, "Memory Overflow");
+      nob_return_defer(false);
+    }
+  }
+  if (options.threaded)
+    result = interpret_bytecode(&bytecode, tape, &rt, options.profile);
+  else
+    result = interpret_tape(program, tape, &rt, tiers, options.profile);
+
+defer:
+  if (guarded)
+    guard_end();
+  if (!runtime_flush(&rt))
+    result = false;
+  runtime_free(&rt);
+  tape_free(tape);
+  nob_da_free(bytecode);
+  return result;
 }
 
 typedef struct {
-  int (*exec)(void *memory);
+  int (*exec)(void *memory, Runtime *rt);
   size_t len;
 } Code;
 
@@ -138,99 +1357,972 @@ typedef struct {
   BackPatch *items;
 } BackPatches;
 
-bool compile_to_machine_code(Program program, size_t memory_size, Code *code) {
-  NOB_String_Builder program_as_machine_code = {0};
-  BackPatches back_patches = {0};
-  Address_Stack address_stack = {0};
+// helper routines emitted once after the program
+typedef enum {
+  LABEL_FLUSH,    // writes out the output buffer, returns an Exec_Status in eax
+  LABEL_REFILL,   // reads the next block of input, returns 0 in eax when it
+                  // got some, 1 at the end of input and 2 if flushing failed
+  LABEL_IO_ERROR,  // returns EXEC_IO_ERROR from the compiled code
+  LABEL_UNDERFLOW, // returns EXEC_UNDERFLOW from the compiled code
+  LABEL_OVERFLOW,  // returns EXEC_OVERFLOW from the compiled code
+  LABEL_LAZY,      // compiles the top-level loop of the call site and patches
+                   // the call to go there from now on
+  COUNT_LABELS,
+} Label;
 
-  nob_da_append_many(&program_as_machine_code, "\x4D\x31\xD2",
-                     3);                                         // xor r10, r10
-  nob_da_append_many(&program_as_machine_code, "\x49\xB8", 2);   // mov r8,
-  nob_da_append_many(&program_as_machine_code, &memory_size, 8); // memory_size
+typedef struct {
+  size_t operand_byte_address;
+  size_t src_byte_address;
+  Label label;
+} Label_Patch;
 
-  for (size_t i = 0; i < program.count; i++) {
-    Operator *op = program.items + i;
-    nob_da_append(&address_stack, program_as_machine_code.count);
-    switch (op->op_kind) {
-    case OP_INC: {
-      nob_da_append_many(&program_as_machine_code, "\x48\xB8", 2); // mov rax,
-      nob_da_append_many(&program_as_machine_code, &(op->operand),
-                         8); // operand
-      nob_da_append_many(&program_as_machine_code, "\x00\x07",
-                         2); // add byte[rdi], al
-    } break;
-    case OP_DEC: {
-      nob_da_append_many(&program_as_machine_code, "\x48\xB8", 2); // mov rax,
-      nob_da_append_many(&program_as_machine_code, &(op->operand),
-                         8); // operand
-      nob_da_append_many(&program_as_machine_code, "\x28\x07",
-                         2); // sub byte[rdi], al
-    } break;
-    case OP_LEFT: {
-      nob_da_append_many(&program_as_machine_code, "\x48\xB8", 2); // mov rax,
-      nob_da_append_many(&program_as_machine_code, &(op->operand),
-                         8); // operand
-      nob_da_append_many(&program_as_machine_code, "\x49\x29\xC2",
-                         3); // sub r10, rax
-      nob_da_append_many(&program_as_machine_code, "\x0F\x89\x08\x00\x00\x00",
-                         6); // jns 8
-      nob_da_append_many(&program_as_machine_code,
-                         "\x48\xC7\xC0\x01\x00\x00\x00", 7);   // mov rax, 1
-      nob_da_append_many(&program_as_machine_code, "\xC3", 1); // ret
-      nob_da_append_many(&program_as_machine_code, "\x48\x29\xC7",
-                         3); // sub rdi, rax
-    } break;
-    case OP_RIGHT: {
-      nob_da_append_many(&program_as_machine_code, "\x48\xB8", 2); // mov rax,
-      nob_da_append_many(&program_as_machine_code, &(op->operand),
-                         8); // operand
-      nob_da_append_many(&program_as_machine_code, "\x49\x01\xC2",
-                         3); // add r10, rax
-      nob_da_append_many(&program_as_machine_code, "\x4D\x39\xD0",
-                         3); // cmp r8, r10
-      nob_da_append_many(&program_as_machine_code, "\x0F\x89\x08\x00\x00\x00",
-                         6); // jns 8
-      nob_da_append_many(&program_as_machine_code,
-                         "\x48\xC7\xC0\x01\x00\x00\x00", 7);   // mov rax, 1
-      nob_da_append_many(&program_as_machine_code, "\xC3", 1); // ret
-      nob_da_append_many(&program_as_machine_code, "\x48\x01\xC7",
-                         3); // add rdi, rax
-    } break;
-    case OP_INPUT: {
-      nob_da_append_many(&program_as_machine_code, "\x57", 1); // push rdi
-      nob_da_append_many(&program_as_machine_code,
-                         "\x48\xC7\xC0\x00\x00\x00\x00", 7); // mov rax, 0
-      nob_da_append_many(&program_as_machine_code, "\x48\x89\xFE",
-                         3); // mov rsi, rdi
-      nob_da_append_many(&program_as_machine_code,
-                         "\x48\xC7\xC7\x00\x00\x00\x00", 7); // mov rdi, 0
-      nob_da_append_many(&program_as_machine_code,
-                         "\x48\xC7\xC2\x01\x00\x00\x00", 7); // mov rdx, 1
-      for (size_t i = 0; i < op->operand; ++i) {
-        nob_da_append_many(&program_as_machine_code, "\x0F\x05", 2); // syscall
+// what the compiled code gets used for
+typedef enum {
+  CODE_PROGRAM,  // runs a whole program and flushes its output
+  CODE_FRAGMENT, // runs a loop for the interpreter, leaves the output to it
+  CODE_LOOP,     // runs a loop called by lazily compiled code, keeps the
+                 // registers of its caller
+} Code_Kind;
+
+typedef struct {
+  size_t return_address; // offset of the instruction after the call
+  size_t start;          // the '[' of the loop
+} Lazy_Site;
+
+typedef struct {
+  Lazy_Site *items;
+  size_t count;
+  size_t capacity;
+} Lazy_Sites;
+
+// a program whose top-level loops get compiled when they are first reached
+typedef struct {
+  Program program;
+  Exec_Options options;
+  char *code;       // region of LAZY_CODE_RESERVE bytes, the program followed
+                    // by the loops compiled so far
+  size_t code_size; // bytes of it in use
+  Lazy_Sites sites; // calls of the loops, ordered by their address
+} Lazy;
+
+void *lazy_compile(Lazy *lazy, char *return_address);
+
+typedef struct {
+  size_t count;
+  size_t capacity;
+  Label_Patch *items;
+} Label_Patches;
+
+void append_label_operand(NOB_String_Builder *code, Label_Patches *patches,
+                          Label label) {
+  Label_Patch lp = {
+      .operand_byte_address = code->count,
+      .src_byte_address = code->count + 4,
+      .label = label,
+  };
+  nob_da_append_many(code, "\x00\x00\x00\x00", 4); // operand
+  nob_da_append(patches, lp);
+}
+
+// appends the 8 bit displacement of a Runtime field
+#define append_runtime_field(code, field)                                      \
+  nob_da_append((code), (char)offsetof(Runtime, field))
+
+// appends the ModRM byte and displacement addressing byte[rdi + offset], reg
+// is the register or opcode extension the instruction puts in there
+void append_rdi_operand(NOB_String_Builder *code, char reg, int32_t offset) {
+  if (offset == 0) {
+    nob_da_append(code, (char)(0x07 | reg << 3));
+  } else if (offset >= INT8_MIN && offset <= INT8_MAX) {
+    nob_da_append(code, (char)(0x47 | reg << 3));
+    nob_da_append(code, (char)offset);
+  } else {
+    nob_da_append(code, (char)(0x87 | reg << 3));
+    nob_da_append_many(code, &offset, 4);
+  }
+}
+
+// points the 8 bit jump whose operand ends at operand_end to the end of code
+void patch_rel8(NOB_String_Builder *code, size_t operand_end) {
+  size_t distance = code->count - operand_end;
+  NOB_ASSERT(distance <= INT8_MAX && "jump too far");
+  code->items[operand_end - 1] = distance;
+}
+
+// same for a jump with a 32 bit operand
+void patch_rel32(NOB_String_Builder *code, size_t operand_end) {
+  int32_t distance = code->count - operand_end;
+  memcpy(code->items + operand_end - 4, &distance, sizeof(distance));
+}
+
+// appends an 8 bit jump back to target
+void append_jump_back(NOB_String_Builder *code, const char *opcode,
+                      size_t target) {
+  nob_da_append(code, opcode[0]);
+  ptrdiff_t distance = (ptrdiff_t)target - (ptrdiff_t)(code->count + 1);
+  NOB_ASSERT(distance >= INT8_MIN && "jump too far");
+  nob_da_append(code, (char)distance);
+}
+
+// calls the C function in the field of the Runtime at offset hook with the
+// Runtime as its argument and returns what it returns when the field is set,
+// otherwise goes on after it. The registers of the program are saved around
+// the call except for the cell cache, which is flushed before any I/O.
+void append_hook_call(NOB_String_Builder *code, char hook) {
+  nob_da_append_many(code, "\x49\x83\x79", 3);
+  nob_da_append(code, hook);
+  nob_da_append_many(code, "\x00", 1);     // cmp qword[r9 + hook], 0
+  nob_da_append_many(code, "\x74\x00", 2); // je .unset
+  size_t unset = code->count;
+  nob_da_append_many(code, "\x41\x52", 2);         // push r10
+  nob_da_append_many(code, "\x41\x51", 2);         // push r9
+  nob_da_append_many(code, "\x41\x50", 2);         // push r8
+  nob_da_append_many(code, "\x57", 1);             // push rdi
+  nob_da_append_many(code, "\x53", 1);             // push rbx
+  nob_da_append_many(code, "\x48\x89\xE3", 3);     // mov rbx, rsp
+  nob_da_append_many(code, "\x48\x83\xE4\xF0", 4); // and rsp, -16
+  nob_da_append_many(code, "\x4C\x89\xCF", 3);     // mov rdi, r9
+  nob_da_append_many(code, "\x41\xFF\x51", 3);
+  nob_da_append(code, hook);                   // call [r9 + hook]
+  nob_da_append_many(code, "\x48\x89\xDC", 3); // mov rsp, rbx
+  nob_da_append_many(code, "\x5B", 1);         // pop rbx
+  nob_da_append_many(code, "\x5F", 1);         // pop rdi
+  nob_da_append_many(code, "\x41\x58", 2);     // pop r8
+  nob_da_append_many(code, "\x41\x59", 2);     // pop r9
+  nob_da_append_many(code, "\x41\x5A", 2);     // pop r10
+  // the callers look at all of rax
+  nob_da_append_many(code, "\x89\xC0", 2); // mov eax, eax
+  nob_da_append_many(code, "\xC3", 1);     // ret
+  // .unset:
+  patch_rel8(code, unset);
+}
+
+// appends the prefixes and the opcode of an instruction on a cell of cell_size
+// bytes. opcode is the one for bytes, the one after it works on the wider
+// cells. rex holds the REX bits the registers of the instruction need, if any.
+void append_cell_opcode(NOB_String_Builder *code, size_t cell_size, char rex,
+                        char opcode) {
+  if (cell_size == 2)
+    nob_da_append(code, '\x66');
+  if (cell_size == 8)
+    rex |= 0x48;
+  if (rex)
+    nob_da_append(code, rex);
+  nob_da_append(code, cell_size == 1 ? opcode : (char)(opcode + 1));
+}
+
+// appends the prefix and opcode of a zero extending load of a cell of
+// cell_size bytes into a whole register, the ModRM byte comes next
+void append_cell_load(NOB_String_Builder *code, size_t cell_size, char rex) {
+  if (cell_size == 8)
+    rex |= 0x48;
+  if (rex)
+    nob_da_append(code, rex);
+  switch (cell_size) {
+  case 1:
+    nob_da_append_many(code, "\x0F\xB6", 2); // movzx r32, r/m8
+    break;
+  case 2:
+    nob_da_append_many(code, "\x0F\xB7", 2); // movzx r32, r/m16
+    break;
+  default:
+    nob_da_append(code, '\x8B'); // mov r32/r64, r/m32/r/m64
+  }
+}
+
+// appends the immediate of an instruction made by append_cell_opcode, 64 bit
+// cells take a 32 bit one that gets sign extended
+void append_cell_immediate(NOB_String_Builder *code, size_t cell_size,
+                           uint64_t value) {
+  uint32_t immediate = value;
+  nob_da_append_many(code, &immediate, cell_size < 4 ? cell_size : 4);
+}
+
+// whether value can be the immediate of an instruction on a cell of cell_size
+// bytes, only 64 bit cells have values too big for that
+bool cell_immediate_fits(size_t cell_size, uint64_t value) {
+  return cell_size < 8 || (int64_t)value == (int32_t)value;
+}
+
+// bytes of the tape the compiled code keeps in registers between two jumps,
+// written back before anything that moves the pointer, calls out or leaves
+// the straight-line code
+#define CELL_CACHE_SIZE 3
+
+// the registers holding cached cells: rdx, rsi and r11, or the part of them
+// as wide as a cell. rex_r has the REX bits for the register in the reg field
+// of ModRM, rex_b the ones for the r/m field and rex_rb the ones for both. sil
+// needs a REX prefix even without any of them.
+static const struct {
+  char reg;
+  char rex_r;
+  char rex_b;
+  char rex_rb;
+} cache_registers[CELL_CACHE_SIZE] = {
+    {2, 0, 0, 0},
+    {6, 0x40, 0x40, 0x40},
+    {3, 0x44, 0x41, 0x45},
+};
+
+typedef struct {
+  bool used;
+  bool dirty; // the register holds a value that is not on the tape yet
+  int32_t offset;
+  size_t last_use;
+} Cached_Cell;
+
+typedef struct {
+  Cached_Cell cells[CELL_CACHE_SIZE];
+  size_t clock;
+  size_t cell_size;
+} Cell_Cache;
+
+// returns the register holding the byte at offset or -1
+int cache_find(Cell_Cache *cache, int32_t offset) {
+  for (int i = 0; i < CELL_CACHE_SIZE; i++) {
+    if (cache->cells[i].used && cache->cells[i].offset == offset) {
+      cache->cells[i].last_use = ++cache->clock;
+      return i;
+    }
+  }
+  return -1;
+}
+
+void cache_write_back(NOB_String_Builder *code, Cell_Cache *cache, int i) {
+  Cached_Cell *cell = cache->cells + i;
+  if (!cell->used || !cell->dirty)
+    return;
+  append_cell_opcode(code, cache->cell_size, cache_registers[i].rex_r,
+                     '\x88'); // mov cell[rdi + offset], reg
+  append_rdi_operand(code, cache_registers[i].reg,
+                     cell->offset * cache->cell_size);
+  cell->dirty = false;
+}
+
+// writes back every dirty byte, with forget the registers are free for other
+// uses afterwards
+void cache_flush(NOB_String_Builder *code, Cell_Cache *cache, bool forget) {
+  for (int i = 0; i < CELL_CACHE_SIZE; i++) {
+    cache_write_back(code, cache, i);
+    if (forget)
+      cache->cells[i].used = false;
+  }
+}
+
+// how far ahead cell_used_again looks for another use of a byte
+#define CELL_CACHE_LOOKAHEAD 32
+
+// tells whether the byte at offset is used again soon after the operator at
+// ip without leaving the straight-line code, a jump at its end uses the
+// current byte. A byte used only once, or overwritten next, is cheaper to
+// change on the tape.
+bool cell_used_again(Program program, size_t ip, ptrdiff_t offset) {
+  for (size_t i = ip + 1; i < program.count && i <= ip + CELL_CACHE_LOOKAHEAD;
+       i++) {
+    Operator *op = program.items + i;
+    switch (op->op_kind) {
+    case OP_INC:
+    case OP_DEC:
+      if (op->offset == offset)
+        return true;
+      break;
+    case OP_SET:
+      if (op->offset == offset)
+        return false;
+      break;
+    case OP_MUL:
+      if (op->offset == offset || op->source == offset)
+        return true;
+      break;
+    case OP_CHECK:
+      break;
+    case OP_JMP_IF_ZERO:
+    case OP_JMP_IF_NON_ZERO:
+      return offset == 0;
+    default:
+      return false;
+    }
+  }
+  return false;
+}
+
+// writes back the cache at the end of straight-line code and tests the
+// current byte for the jump that follows, the cache is empty afterwards
+void append_jump_test(NOB_String_Builder *code, Cell_Cache *cache) {
+  cache_flush(code, cache, false);
+  int i = cache_find(cache, 0);
+  if (i >= 0) {
+    append_cell_opcode(code, cache->cell_size, cache_registers[i].rex_rb,
+                       '\x84'); // test reg, reg
+    nob_da_append(code, (char)(0xC0 | cache_registers[i].reg << 3 |
+                               cache_registers[i].reg));
+  } else if (cache->cell_size == 1) {
+    nob_da_append_many(code, "\x8A\x07", 2); // mov al, byte[rdi]
+    nob_da_append_many(code, "\x84\xC0", 2); // test al, al
+  } else {
+    append_cell_load(code, cache->cell_size, 0); // mov eax/rax,
+    nob_da_append(code, '\x07');                 // cell[rdi]
+    append_cell_opcode(code, cache->cell_size, 0, '\x84'); // test
+    nob_da_append(code, '\xC0');                            // eax/rax
+  }
+  cache_flush(code, cache, true);
+}
+
+// returns a register for the byte at offset, loading its value from the tape
+// unless the caller is about to overwrite it. The least recently used byte
+// makes room when all registers are taken, the current one only if nothing
+// else can since the jump at the end tests it.
+int cache_take(NOB_String_Builder *code, Cell_Cache *cache, int32_t offset,
+               bool load) {
+  int i = cache_find(cache, offset);
+  if (i >= 0)
+    return i;
+  i = -1;
+  for (int j = 0; j < CELL_CACHE_SIZE; j++) {
+    Cached_Cell *cell = cache->cells + j;
+    if (!cell->used) {
+      i = j;
+      break;
+    }
+    if (i < 0 || (cache->cells[i].offset == 0 && cell->offset != 0) ||
+        (cell->offset != 0 && cell->last_use < cache->cells[i].last_use))
+      i = j;
+  }
+  cache_write_back(code, cache, i);
+  if (load) {
+    // filling the whole register keeps it from depending on its old value
+    append_cell_load(code, cache->cell_size,
+                     cache_registers[i].rex_r); // movzx reg, cell[rdi +
+    append_rdi_operand(code, cache_registers[i].reg,
+                       offset * cache->cell_size); // offset]
+  }
+  Cached_Cell cell = {
+      .used = true,
+      .offset = offset,
+      .last_use = ++cache->clock,
+  };
+  cache->cells[i] = cell;
+  return i;
+}
+
+// cuts value down to the width of a cell of cell_size bytes
+uint64_t cell_value(size_t cell_size, uint64_t value) {
+  return cell_size < 8 ? value & ((1ull << 8 * cell_size) - 1) : value;
+}
+
+// appends an add (ext 0) or a sub (ext 5) of value to the cell in the cache
+// register reg, or to the one at offset on the tape when reg is negative.
+// Values too big for an immediate go through rax.
+void append_cell_arithmetic(NOB_String_Builder *code, size_t cell_size,
+                            char ext, uint64_t value, int reg,
+                            int32_t offset) {
+  char rex = reg >= 0 ? cache_registers[reg].rex_b : 0;
+  if (!cell_immediate_fits(cell_size, value)) {
+    nob_da_append_many(code, "\x48\xB8", 2); // mov rax,
+    nob_da_append_many(code, &value, 8);     // value
+    append_cell_opcode(code, cell_size, rex,
+                       ext == 0 ? '\x00' : '\x28'); // add/sub
+    if (reg >= 0)
+      nob_da_append(code, (char)(0xC0 | cache_registers[reg].reg)); // reg, rax
+    else
+      append_rdi_operand(code, 0, offset * cell_size); // [rdi + offset], rax
+    return;
+  }
+  append_cell_opcode(code, cell_size, rex, '\x80'); // add/sub
+  if (reg >= 0)
+    nob_da_append(code, (char)(0xC0 | ext << 3 | cache_registers[reg].reg));
+  else
+    append_rdi_operand(code, ext, offset * cell_size);
+  append_cell_immediate(code, cell_size, value);
+}
+
+// appends a store of value to the cell in the cache register reg, or to the
+// one at offset on the tape when reg is negative
+void append_cell_set(NOB_String_Builder *code, size_t cell_size,
+                     uint64_t value, int reg, int32_t offset) {
+  value = cell_value(cell_size, value);
+  if (reg >= 0) {
+    // a 32 bit mov fills the whole register
+    size_t size = value > UINT32_MAX ? 8 : 4;
+    char rex = cache_registers[reg].rex_b | (size == 8 ? 0x48 : 0);
+    if (rex)
+      nob_da_append(code, rex);
+    nob_da_append(code, (char)(0xB8 | cache_registers[reg].reg)); // mov reg,
+    nob_da_append_many(code, &value, size);                      // value
+    return;
+  }
+  if (!cell_immediate_fits(cell_size, value)) {
+    nob_da_append_many(code, "\x48\xB8", 2); // mov rax,
+    nob_da_append_many(code, &value, 8);     // value
+    append_cell_opcode(code, cell_size, 0, '\x88');   // mov [rdi +
+    append_rdi_operand(code, 0, offset * cell_size); // offset], rax
+    return;
+  }
+  append_cell_opcode(code, cell_size, 0, '\xC6');   // mov [rdi +
+  append_rdi_operand(code, 0, offset * cell_size); // offset],
+  append_cell_immediate(code, cell_size, value);   // value
+}
+
+// appends the operators from begin to end, which hold whole loops, to code.
+// The calls of the helper labels are left open and noted in patches with
+// their offsets in code. The offset every operator starts at goes into
+// addresses unless it is NULL.
+void operators_to_machine_code(Program program, size_t begin, size_t end,
+                               Exec_Options options, Lazy *lazy,
+                               NOB_String_Builder *code,
+                               Label_Patches *patches,
+                               Address_Stack *addresses) {
+  // taken over for the length of the function and handed back at its end
+  NOB_String_Builder program_as_machine_code = *code;
+  Label_Patches label_patches = *patches;
+  BackPatches back_patches = {0};
+  Address_Stack address_stack = {0};
+  // scans compare 32 bytes at once when the cpu can do it, 16 otherwise
+  bool avx2 = __builtin_cpu_supports("avx2");
+  size_t vector_width = avx2 ? 32 : 16;
+  // the guard pages around an unchecked tape fault on any access off it, moves
+  // too far to be caught by them keep their check
+  bool checked = !options.unchecked;
+  bool caching = options.cache_cells;
+  // the pointer in rdi counts bytes, the head in r10 cells
+  size_t cell_size = options.cell_size;
+  int cell_shift = __builtin_ctzll(cell_size);
+  Cell_Cache cache = {.cell_size = cell_size};
+
+  for (size_t i = begin; i < end; i++) {
+    Operator *op = program.items + i;
+    nob_da_append(&address_stack, program_as_machine_code.count);
+    if (options.profile && i > begin &&
+        program.items[i - 1].op_kind == OP_JMP_IF_ZERO) {
+      // where the body starts, both the '[' and the ']' of the loop get here
+      // when they go on with it
+      uint64_t *count = options.profile + i - 1;
+      nob_da_append_many(&program_as_machine_code, "\x48\xB8", 2); // mov rax,
+      nob_da_append_many(&program_as_machine_code, &count, 8);      // count
+      nob_da_append_many(&program_as_machine_code, "\x48\xFF\x00",
+                         3); // inc qword[rax]
+    }
+    if (lazy && op->op_kind == OP_JMP_IF_ZERO) {
+      // loops that are never entered never get compiled
+      append_jump_test(&program_as_machine_code, &cache);
+      nob_da_append_many(&program_as_machine_code, "\x74\x0A", 2); // jz .skip
+      nob_da_append_many(&program_as_machine_code, "\xE8", 1);     // call
+      append_label_operand(&program_as_machine_code, &label_patches,
+                           LABEL_LAZY); // lazy
+      Lazy_Site site = {
+          .return_address = program_as_machine_code.count,
+          .start = i,
+      };
+      nob_da_append(&lazy->sites, site);
+      nob_da_append_many(&program_as_machine_code, "\x85\xC0",
+                         2); // test eax, eax
+      nob_da_append_many(&program_as_machine_code, "\x74\x01", 2); // jz +1
+      nob_da_append_many(&program_as_machine_code, "\xC3", 1);     // ret
+      // .skip:
+      // the loop itself stays out of this code
+      for (i++; i < op->operand; i++)
+        nob_da_append(&address_stack, program_as_machine_code.count);
+      i--;
+      continue;
+    }
+    switch (op->op_kind) {
+    case OP_INC: {
+      int reg = caching ? cache_find(&cache, op->offset) : -1;
+      if (reg < 0 && caching && cell_used_again(program, i, op->offset))
+        reg = cache_take(&program_as_machine_code, &cache, op->offset, true);
+      if (reg >= 0)
+        cache.cells[reg].dirty = true;
+      append_cell_arithmetic(&program_as_machine_code, cell_size, 0,
+                             op->operand, reg, op->offset);
+    } break;
+    case OP_DEC: {
+      int reg = caching ? cache_find(&cache, op->offset) : -1;
+      if (reg < 0 && caching && cell_used_again(program, i, op->offset))
+        reg = cache_take(&program_as_machine_code, &cache, op->offset, true);
+      if (reg >= 0)
+        cache.cells[reg].dirty = true;
+      append_cell_arithmetic(&program_as_machine_code, cell_size, 5,
+                             op->operand, reg, op->offset);
+    } break;
+    case OP_LEFT: {
+      cache_flush(&program_as_machine_code, &cache, true);
+      if (op->operand > INT32_MAX / cell_size) {
+        nob_da_append_many(&program_as_machine_code, "\x48\xB8",
+                           2); // mov rax,
+        nob_da_append_many(&program_as_machine_code, &(op->operand),
+                           8); // operand
+        nob_da_append_many(&program_as_machine_code, "\x49\x29\xC2",
+                           3); // sub r10, rax
+        nob_da_append_many(&program_as_machine_code, "\x0F\x82", 2); // jb
+        append_label_operand(&program_as_machine_code, &label_patches,
+                             LABEL_UNDERFLOW); // underflow
+        if (cell_shift) {
+          nob_da_append_many(&program_as_machine_code, "\x48\xC1\xE0",
+                             3); // shl rax,
+          nob_da_append(&program_as_machine_code, (char)cell_shift); // shift
+        }
+        nob_da_append_many(&program_as_machine_code, "\x48\x29\xC7",
+                           3); // sub rdi, rax
+        break;
+      }
+      uint32_t operand = op->operand;
+      uint32_t bytes = op->operand * cell_size;
+      nob_da_append_many(&program_as_machine_code, "\x49\x81\xEA",
+                         3);                                        // sub r10,
+      nob_da_append_many(&program_as_machine_code, &operand, 4); // operand
+      if (checked) {
+        nob_da_append_many(&program_as_machine_code, "\x0F\x82", 2); // jb
+        append_label_operand(&program_as_machine_code, &label_patches,
+                             LABEL_UNDERFLOW); // underflow
+      }
+      nob_da_append_many(&program_as_machine_code, "\x48\x81\xEF",
+                         3);                                      // sub rdi,
+      nob_da_append_many(&program_as_machine_code, &bytes, 4); // bytes
+    } break;
+    case OP_RIGHT: {
+      cache_flush(&program_as_machine_code, &cache, true);
+      if (op->operand > INT32_MAX / cell_size) {
+        nob_da_append_many(&program_as_machine_code, "\x48\xB8",
+                           2); // mov rax,
+        nob_da_append_many(&program_as_machine_code, &(op->operand),
+                           8); // operand
+        nob_da_append_many(&program_as_machine_code, "\x49\x01\xC2",
+                           3); // add r10, rax
+        nob_da_append_many(&program_as_machine_code, "\x4D\x39\xC2",
+                           3); // cmp r10, r8
+        nob_da_append_many(&program_as_machine_code, "\x0F\x83", 2); // jae
+        append_label_operand(&program_as_machine_code, &label_patches,
+                             LABEL_OVERFLOW); // overflow
+        if (cell_shift) {
+          nob_da_append_many(&program_as_machine_code, "\x48\xC1\xE0",
+                             3); // shl rax,
+          nob_da_append(&program_as_machine_code, (char)cell_shift); // shift
+        }
+        nob_da_append_many(&program_as_machine_code, "\x48\x01\xC7",
+                           3); // add rdi, rax
+        break;
+      }
+      uint32_t operand = op->operand;
+      uint32_t bytes = op->operand * cell_size;
+      nob_da_append_many(&program_as_machine_code, "\x49\x81\xC2",
+                         3);                                        // add r10,
+      nob_da_append_many(&program_as_machine_code, &operand, 4); // operand
+      if (checked) {
+        nob_da_append_many(&program_as_machine_code, "\x4D\x39\xC2",
+                           3); // cmp r10, r8
+        nob_da_append_many(&program_as_machine_code, "\x0F\x83", 2); // jae
+        append_label_operand(&program_as_machine_code, &label_patches,
+                             LABEL_OVERFLOW); // overflow
+      }
+      nob_da_append_many(&program_as_machine_code, "\x48\x81\xC7",
+                         3);                                      // add rdi,
+      nob_da_append_many(&program_as_machine_code, &bytes, 4); // bytes
+    } break;
+    case OP_CHECK: {
+      int32_t low = op->offset;
+      int32_t high = op->operand;
+      if (!checked)
+        break;
+      if (low < 0) {
+        uint32_t distance = -low;
+        nob_da_append_many(&program_as_machine_code, "\x49\x81\xFA",
+                           3); // cmp r10,
+        nob_da_append_many(&program_as_machine_code, &distance, 4); // -low
+        nob_da_append_many(&program_as_machine_code, "\x0F\x82", 2); // jb
+        append_label_operand(&program_as_machine_code, &label_patches,
+                             LABEL_UNDERFLOW); // underflow
+      }
+      if (high > 0) {
+        nob_da_append_many(&program_as_machine_code, "\x49\x8D\x8A",
+                           3); // lea rcx, [r10 +
+        nob_da_append_many(&program_as_machine_code, &high, 4); // high]
+        nob_da_append_many(&program_as_machine_code, "\x4C\x39\xC1",
+                           3); // cmp rcx, r8
+        nob_da_append_many(&program_as_machine_code, "\x0F\x83", 2); // jae
+        append_label_operand(&program_as_machine_code, &label_patches,
+                             LABEL_OVERFLOW); // overflow
+      }
+    } break;
+    case OP_INPUT: {
+      cache_flush(&program_as_machine_code, &cache, true);
+      // the bytes come out of the input buffer, the runtime is only called
+      // once it is empty
+      for (size_t i = 0; i < op->operand; ++i) {
+        nob_da_append_many(&program_as_machine_code, "\x49\x8B\x41", 3);
+        append_runtime_field(&program_as_machine_code,
+                             in_pos); // mov rax, [r9 + in_pos]
+        nob_da_append_many(&program_as_machine_code, "\x49\x3B\x41", 3);
+        append_runtime_field(&program_as_machine_code,
+                             in_count); // cmp rax, [r9 + in_count]
+        nob_da_append_many(&program_as_machine_code, "\x72\x00",
+                           2); // jb .have
+        size_t have = program_as_machine_code.count;
+        nob_da_append_many(&program_as_machine_code, "\xE8", 1); // call
+        append_label_operand(&program_as_machine_code, &label_patches,
+                             LABEL_REFILL); // refill
+        nob_da_append_many(&program_as_machine_code, "\x83\xF8\x01",
+                           3); // cmp eax, 1
+        nob_da_append_many(&program_as_machine_code, "\x0F\x87", 2); // ja
+        append_label_operand(&program_as_machine_code, &label_patches,
+                             LABEL_IO_ERROR); // io_error
+        nob_da_append_many(&program_as_machine_code, "\x74\x00",
+                           2); // je .eof
+        size_t eof = program_as_machine_code.count;
+        // .have: rax holds in_pos, refill leaves 0 in it
+        patch_rel8(&program_as_machine_code, have);
+        nob_da_append_many(&program_as_machine_code, "\x49\x8B\x49", 3);
+        append_runtime_field(&program_as_machine_code,
+                             in_items); // mov rcx, [r9 + in_items]
+        if (cell_size == 1) {
+          nob_da_append_many(&program_as_machine_code, "\x8A\x0C\x01",
+                             3); // mov cl, byte[rcx + rax]
+        } else {
+          nob_da_append_many(&program_as_machine_code, "\x0F\xB6\x0C\x01",
+                             4); // movzx ecx, byte[rcx + rax]
+        }
+        append_cell_opcode(&program_as_machine_code, cell_size, 0,
+                           '\x88'); // mov
+        append_rdi_operand(&program_as_machine_code, 1,
+                           op->offset * cell_size); // [rdi + offset], rcx
+        nob_da_append_many(&program_as_machine_code, "\x48\xFF\xC0",
+                           3); // inc rax
+        nob_da_append_many(&program_as_machine_code, "\x49\x89\x41", 3);
+        append_runtime_field(&program_as_machine_code,
+                             in_pos); // mov [r9 + in_pos], rax
+        nob_da_append_many(&program_as_machine_code, "\xEB\x00",
+                           2); // jmp .done
+        size_t done = program_as_machine_code.count;
+        // .eof:
+        patch_rel8(&program_as_machine_code, eof);
+        nob_da_append_many(&program_as_machine_code, "\x41\x8B\x41", 3);
+        append_runtime_field(&program_as_machine_code,
+                             eof_mode); // mov eax, [r9 + eof_mode]
+        nob_da_append_many(&program_as_machine_code, "\x85\xC0",
+                           2); // test eax, eax
+        nob_da_append_many(&program_as_machine_code, "\x74\x00",
+                           2); // jz .done
+        size_t leave = program_as_machine_code.count;
+        nob_da_append_many(&program_as_machine_code, "\x83\xF8\x01",
+                           3); // cmp eax, EOF_ZERO
+        nob_da_append_many(&program_as_machine_code, "\x0F\x94\xC0",
+                           3); // sete al
+        if (cell_size == 1) {
+          nob_da_append_many(&program_as_machine_code, "\xFE\xC8",
+                             2); // dec al
+        } else {
+          nob_da_append_many(&program_as_machine_code, "\x0F\xB6\xC0",
+                             3); // movzx eax, al
+          nob_da_append_many(&program_as_machine_code, "\x48\xFF\xC8",
+                             3); // dec rax
+        }
+        append_cell_opcode(&program_as_machine_code, cell_size, 0,
+                           '\x88'); // mov
+        append_rdi_operand(&program_as_machine_code, 0,
+                           op->offset * cell_size); // [rdi + offset], rax
+        // .done:
+        patch_rel8(&program_as_machine_code, done);
+        patch_rel8(&program_as_machine_code, leave);
       }
-      nob_da_append_many(&program_as_machine_code, "\x5F", 1); // pop rdi
     } break;
     case OP_OUTPUT: {
-      nob_da_append_many(&program_as_machine_code, "\x57", 1); // push rdi
+      cache_flush(&program_as_machine_code, &cache, true);
+      // the bytes are appended to the output buffer which only gets written
+      // out once it is full
+      size_t left = op->operand;
+      while (left) {
+        uint32_t chunk = left < RUNTIME_BUFFER_CAPACITY
+                             ? left
+                             : RUNTIME_BUFFER_CAPACITY;
+        uint32_t limit = RUNTIME_BUFFER_CAPACITY - chunk;
+        left -= chunk;
+        nob_da_append_many(&program_as_machine_code, "\x49\x8B\x41", 3);
+        append_runtime_field(&program_as_machine_code,
+                             out_count); // mov rax, [r9 + out_count]
+        nob_da_append_many(&program_as_machine_code, "\x48\x3D", 2); // cmp rax,
+        nob_da_append_many(&program_as_machine_code, &limit, 4); // limit
+        nob_da_append_many(&program_as_machine_code, "\x76\x0D",
+                           2); // jbe 13
+        nob_da_append_many(&program_as_machine_code, "\xE8", 1); // call
+        append_label_operand(&program_as_machine_code, &label_patches,
+                             LABEL_FLUSH); // flush
+        nob_da_append_many(&program_as_machine_code, "\x85\xC0",
+                           2); // test eax, eax
+        nob_da_append_many(&program_as_machine_code, "\x0F\x85", 2); // jnz
+        append_label_operand(&program_as_machine_code, &label_patches,
+                             LABEL_IO_ERROR); // io_error
+        // rax holds out_count here, flush leaves 0 in it
+        nob_da_append_many(&program_as_machine_code, "\x49\x8B\x49", 3);
+        append_runtime_field(&program_as_machine_code,
+                             out_items); // mov rcx, [r9 + out_items]
+        nob_da_append_many(&program_as_machine_code, "\x48\x01\xC1",
+                           3); // add rcx, rax
+        // the cell is read before the output counts the bytes, on a guarded
+        // tape that read may fault and the bytes must not go out then
+        nob_da_append_many(&program_as_machine_code, "\x8A", 1); // mov dl,
+        append_rdi_operand(&program_as_machine_code, 2,
+                           op->offset * cell_size); // byte[rdi + offset]
+        nob_da_append_many(&program_as_machine_code, "\x48\x05", 2); // add rax,
+        nob_da_append_many(&program_as_machine_code, &chunk, 4); // chunk
+        nob_da_append_many(&program_as_machine_code, "\x49\x89\x41", 3);
+        append_runtime_field(&program_as_machine_code,
+                             out_count); // mov [r9 + out_count], rax
+        if (chunk == 1) {
+          nob_da_append_many(&program_as_machine_code, "\x88\x11",
+                             2); // mov byte[rcx], dl
+        } else {
+          nob_da_append_many(&program_as_machine_code, "\x57", 1); // push rdi
+          nob_da_append_many(&program_as_machine_code, "\x48\x89\xCF",
+                             3); // mov rdi, rcx
+          nob_da_append_many(&program_as_machine_code, "\x88\xD0",
+                             2); // mov al, dl
+          nob_da_append_many(&program_as_machine_code, "\xB9", 1); // mov ecx,
+          nob_da_append_many(&program_as_machine_code, &chunk, 4); // chunk
+          nob_da_append_many(&program_as_machine_code, "\xF3\xAA",
+                             2);                                    // rep stosb
+          nob_da_append_many(&program_as_machine_code, "\x5F", 1); // pop rdi
+        }
+      }
+    } break;
+    case OP_SET: {
+      int reg = caching ? cache_find(&cache, op->offset) : -1;
+      if (reg < 0 && caching && cell_used_again(program, i, op->offset))
+        reg = cache_take(&program_as_machine_code, &cache, op->offset, false);
+      if (reg >= 0)
+        cache.cells[reg].dirty = true;
+      append_cell_set(&program_as_machine_code, cell_size, op->operand, reg,
+                      op->offset);
+    } break;
+    case OP_MUL: {
+      int32_t offset = op->offset;
+      uint64_t factor = cell_value(cell_size, op->operand);
+      // the cell added to is only taken from the cache, loading it would
+      // touch it even when the source is zero
+      int reg = caching ? cache_find(&cache, op->source) : -1;
+      if (reg < 0 && caching && cell_used_again(program, i, op->source))
+        reg = cache_take(&program_as_machine_code, &cache, op->source, true);
+      int target = caching ? cache_find(&cache, offset) : -1;
+      if (reg >= 0) {
+        append_cell_load(&program_as_machine_code, cell_size,
+                         cache_registers[reg].rex_b); // movzx
+        nob_da_append(&program_as_machine_code,
+                      (char)(0xC0 | cache_registers[reg].reg)); // eax, reg
+      } else {
+        append_cell_load(&program_as_machine_code, cell_size,
+                         0); // movzx eax, cell[rdi +
+        append_rdi_operand(&program_as_machine_code, 0,
+                           op->source * cell_size); // source]
+      }
+      append_cell_opcode(&program_as_machine_code, cell_size, 0,
+                         '\x84'); // test
+      nob_da_append(&program_as_machine_code, '\xC0'); // eax, eax
+      nob_da_append_many(&program_as_machine_code, "\x74\x00", 2); // jz .skip
+      size_t skip = program_as_machine_code.count;
+      if (checked) {
+        nob_da_append_many(&program_as_machine_code, "\x49\x8D\x8A",
+                           3); // lea rcx, [r10 +
+        nob_da_append_many(&program_as_machine_code, &offset, 4); // offset]
+        nob_da_append_many(&program_as_machine_code, "\x4C\x39\xC1",
+                           3); // cmp rcx, r8
+        nob_da_append_many(&program_as_machine_code, "\x0F\x83", 2); // jae
+        append_label_operand(&program_as_machine_code, &label_patches,
+                             offset < 0 ? LABEL_UNDERFLOW
+                                        : LABEL_OVERFLOW); // underflow/overflow
+      }
+      if (factor > 1 && cell_immediate_fits(cell_size, factor)) {
+        if (cell_size == 8)
+          nob_da_append(&program_as_machine_code, '\x48'); // REX.W
+        nob_da_append_many(&program_as_machine_code, "\x69\xC0",
+                           2); // imul eax, eax,
+        nob_da_append_many(&program_as_machine_code, &factor, 4); // factor
+      } else if (factor > 1) {
+        nob_da_append_many(&program_as_machine_code, "\x48\xB9",
+                           2);                                     // mov rcx,
+        nob_da_append_many(&program_as_machine_code, &factor, 8); // factor
+        nob_da_append_many(&program_as_machine_code, "\x48\x0F\xAF\xC1",
+                           4); // imul rax, rcx
+      }
+      if (factor && target >= 0) {
+        append_cell_opcode(&program_as_machine_code, cell_size,
+                           cache_registers[target].rex_b, '\x00'); // add
+        nob_da_append(&program_as_machine_code,
+                      (char)(0xC0 | cache_registers[target].reg)); // reg, rax
+        cache.cells[target].dirty = true;
+      } else if (factor) {
+        append_cell_opcode(&program_as_machine_code, cell_size, 0,
+                           '\x00'); // add cell[rdi +
+        append_rdi_operand(&program_as_machine_code, 0,
+                           offset * cell_size); // offset], rax
+      }
+      // .skip:
+      patch_rel8(&program_as_machine_code, skip);
+    } break;
+    case OP_SCAN_LEFT:
+    case OP_SCAN_RIGHT: {
+      cache_flush(&program_as_machine_code, &cache, true);
+      bool left = op->op_kind == OP_SCAN_LEFT;
+      uint32_t stride = op->operand;
+      uint32_t step = stride * cell_size;
+      if (vector_width % step || (cell_size == 8 && !avx2)) {
+        // strides that don't fit a vector go one cell at a time, so do 64 bit
+        // cells unless there is a vector compare for them
+        size_t loop = program_as_machine_code.count;
+        append_cell_opcode(&program_as_machine_code, cell_size, 0,
+                           '\x80'); // cmp
+        nob_da_append(&program_as_machine_code, '\x3F'); // cell[rdi],
+        append_cell_immediate(&program_as_machine_code, cell_size, 0); // 0
+        nob_da_append_many(&program_as_machine_code, "\x74\x00",
+                           2); // je .done
+        size_t done = program_as_machine_code.count;
+        nob_da_append_many(&program_as_machine_code,
+                           left ? "\x48\x81\xEF" : "\x48\x81\xC7",
+                           3); // sub/add rdi,
+        nob_da_append_many(&program_as_machine_code, &step, 4); // step
+        nob_da_append_many(&program_as_machine_code,
+                           left ? "\x49\x81\xEA" : "\x49\x81\xC2",
+                           3); // sub/add r10,
+        nob_da_append_many(&program_as_machine_code, &stride, 4); // stride
+        if (!checked) {
+          append_jump_back(&program_as_machine_code, "\xEB",
+                           loop); // jmp .loop
+        } else if (left) {
+          append_jump_back(&program_as_machine_code, "\x73",
+                           loop); // jae .loop
+        } else {
+          nob_da_append_many(&program_as_machine_code, "\x4D\x39\xC2",
+                             3); // cmp r10, r8
+          append_jump_back(&program_as_machine_code, "\x72",
+                           loop); // jb .loop
+        }
+        if (checked) {
+          nob_da_append_many(&program_as_machine_code, "\xE9", 1); // jmp
+          append_label_operand(&program_as_machine_code, &label_patches,
+                               left ? LABEL_UNDERFLOW
+                                    : LABEL_OVERFLOW); // underflow/overflow
+        }
+        // .done:
+        patch_rel8(&program_as_machine_code, done);
+        break;
+      }
+
+      // the vectors are loaded from aligned addresses, see scan_right. The
+      // padding around a checked tape stops a scan that runs off either end
+      // and the guard pages fault on one running off an unchecked tape, so
+      // the loop itself needs no bounds check. edx holds the lanes of the
+      // stride, r11d those still to look at in the current vector, a lane
+      // being a byte of which only the first one of a cell counts.
+      uint32_t lanes = scan_lane_mask(step, vector_width);
+      nob_da_append_many(&program_as_machine_code, "\x48\x89\xF9",
+                         3); // mov rcx, rdi
+      nob_da_append_many(&program_as_machine_code, "\x83\xE1", 2); // and ecx,
+      nob_da_append(&program_as_machine_code,
+                    (char)(vector_width - 1)); // width - 1
+      nob_da_append_many(&program_as_machine_code, "\x48\x29\xCF",
+                         3); // sub rdi, rcx
+      if (cell_shift) {
+        nob_da_append_many(&program_as_machine_code, "\x89\xC8",
+                           2); // mov eax, ecx
+        nob_da_append_many(&program_as_machine_code, "\xC1\xE8",
+                           2); // shr eax,
+        nob_da_append(&program_as_machine_code, (char)cell_shift); // shift
+        nob_da_append_many(&program_as_machine_code, "\x49\x29\xC2",
+                           3); // sub r10, rax
+      } else {
+        nob_da_append_many(&program_as_machine_code, "\x49\x29\xCA",
+                           3); // sub r10, rcx
+      }
+      nob_da_append_many(&program_as_machine_code, "\xBA", 1); // mov edx,
+      nob_da_append_many(&program_as_machine_code, &lanes, 4); // lanes
+      if (avx2) {
+        nob_da_append_many(&program_as_machine_code, "\xD3\xC2",
+                           2); // rol edx, cl
+      } else {
+        nob_da_append_many(&program_as_machine_code, "\x66\xD3\xC2",
+                           3); // rol dx, cl
+      }
       nob_da_append_many(&program_as_machine_code,
-                         "\x48\xC7\xC0\x01\x00\x00\x00", 7); // mov rax, 1
-      nob_da_append_many(&program_as_machine_code, "\x48\x89\xFE",
-                         3); // mov rsi, rdi
+                         left ? "\x41\xBB\xFE\xFF\xFF\xFF"
+                              : "\x41\xBB\xFF\xFF\xFF\xFF",
+                         6); // mov r11d, -2/-1
+      nob_da_append_many(&program_as_machine_code, "\x41\xD3\xE3",
+                         3); // shl r11d, cl
+      if (left) {
+        nob_da_append_many(&program_as_machine_code, "\x41\xF7\xD3",
+                           3); // not r11d
+      }
+      nob_da_append_many(&program_as_machine_code, "\x41\x21\xD3",
+                         3); // and r11d, edx
       nob_da_append_many(&program_as_machine_code,
-                         "\x48\xC7\xC7\x01\x00\x00\x00", 7); // mov rdi, 1
+                         avx2 ? "\xC5\xF5\xEF\xC9" : "\x66\x0F\xEF\xC9",
+                         4); // pxor xmm1, xmm1
+      // .loop:
+      size_t loop = program_as_machine_code.count;
       nob_da_append_many(&program_as_machine_code,
-                         "\x48\xC7\xC2\x01\x00\x00\x00", 7); // mov rdx, 1
-      for (size_t i = 0; i < op->operand; ++i) {
-        nob_da_append_many(&program_as_machine_code, "\x0F\x05", 2); // syscall
+                         avx2 ? "\xC5\xFD\x6F\x07" : "\x66\x0F\x6F\x07",
+                         4); // movdqa xmm0, [rdi]
+      if (cell_size == 8) {
+        nob_da_append_many(&program_as_machine_code, "\xC4\xE2\x7D\x29\xC1",
+                           5); // vpcmpeqq ymm0, ymm0, ymm1
+      } else {
+        nob_da_append_many(&program_as_machine_code,
+                           avx2 ? "\xC5\xFD" : "\x66\x0F", 2);
+        nob_da_append(&program_as_machine_code, (char)(0x74 + cell_shift));
+        nob_da_append(&program_as_machine_code,
+                      '\xC1'); // pcmpeqb/w/d xmm0, xmm1
+      }
+      nob_da_append_many(&program_as_machine_code,
+                         avx2 ? "\xC5\xFD\xD7\xC0" : "\x66\x0F\xD7\xC0",
+                         4); // pmovmskb eax, xmm0
+      nob_da_append_many(&program_as_machine_code, "\x44\x21\xD8",
+                         3); // and eax, r11d
+      nob_da_append_many(&program_as_machine_code, "\x75\x00",
+                         2); // jnz .found
+      size_t found = program_as_machine_code.count;
+      nob_da_append_many(&program_as_machine_code, "\x41\x89\xD3",
+                         3); // mov r11d, edx
+      nob_da_append_many(&program_as_machine_code,
+                         left ? "\x48\x83\xEF" : "\x48\x83\xC7",
+                         3); // sub/add rdi,
+      nob_da_append(&program_as_machine_code, (char)vector_width); // width
+      nob_da_append_many(&program_as_machine_code,
+                         left ? "\x49\x83\xEA" : "\x49\x83\xC2",
+                         3); // sub/add r10,
+      nob_da_append(&program_as_machine_code,
+                    (char)(vector_width / cell_size)); // width / cell_size
+      append_jump_back(&program_as_machine_code, "\xEB", loop); // jmp .loop
+      // .found:
+      patch_rel8(&program_as_machine_code, found);
+      if (avx2) {
+        nob_da_append_many(&program_as_machine_code, "\xC5\xF8\x77",
+                           3); // vzeroupper
+      }
+      nob_da_append_many(&program_as_machine_code,
+                         left ? "\x0F\xBD\xC0" : "\x0F\xBC\xC0",
+                         3); // bsr/bsf eax, eax
+      nob_da_append_many(&program_as_machine_code, "\x48\x01\xC7",
+                         3); // add rdi, rax
+      if (cell_shift) {
+        nob_da_append_many(&program_as_machine_code, "\xC1\xE8",
+                           2); // shr eax,
+        nob_da_append(&program_as_machine_code, (char)cell_shift); // shift
+      }
+      nob_da_append_many(&program_as_machine_code, "\x49\x01\xC2",
+                         3); // add r10, rax
+      if (!checked)
+        break;
+      if (left) {
+        nob_da_append_many(&program_as_machine_code, "\x0F\x88", 2); // js
+      } else {
+        nob_da_append_many(&program_as_machine_code, "\x4D\x39\xC2",
+                           3); // cmp r10, r8
+        nob_da_append_many(&program_as_machine_code, "\x0F\x83",
+                           2); // jae
       }
-      nob_da_append_many(&program_as_machine_code, "\x5F", 1); // pop rdi
+      append_label_operand(&program_as_machine_code, &label_patches,
+                           left ? LABEL_UNDERFLOW
+                                : LABEL_OVERFLOW); // underflow/overflow
     } break;
     case OP_JMP_IF_ZERO: {
-      nob_da_append_many(&program_as_machine_code, "\x8A\x07",
-                         2); // mov al, byte[rdi]
-      nob_da_append_many(&program_as_machine_code, "\x84\xC0",
-                         2); // test al, al
+      append_jump_test(&program_as_machine_code, &cache);
       nob_da_append_many(&program_as_machine_code, "\x0F\x84", 2); // jz
       size_t operand_byte_addr = program_as_machine_code.count;
       nob_da_append_many(&program_as_machine_code, "\x00\x00\x00\x00",
@@ -243,10 +2335,7 @@ bool compile_to_machine_code(Program program, size_t memory_size, Code *code) {
       nob_da_append(&back_patches, bp);
     } break;
     case OP_JMP_IF_NON_ZERO: {
-      nob_da_append_many(&program_as_machine_code, "\x8A\x07",
-                         2); // mov al, byte[rdi]
-      nob_da_append_many(&program_as_machine_code, "\x84\xC0",
-                         2); // test al, al
+      append_jump_test(&program_as_machine_code, &cache);
       nob_da_append_many(&program_as_machine_code, "\x0F\x85", 2); // jnz
       size_t operand_byte_addr = program_as_machine_code.count;
       nob_da_append_many(&program_as_machine_code, "\x00\x00\x00\x00",
@@ -262,167 +2351,2728 @@ bool compile_to_machine_code(Program program, size_t memory_size, Code *code) {
     default:
       NOB_ASSERT(0 && "Unreachable");
     }
+    if (options.water_marks &&
+        (op->op_kind == OP_LEFT || op->op_kind == OP_SCAN_LEFT)) {
+      // signed, a move off an unchecked tape to the left goes below zero
+      // instead of wrapping around
+      nob_da_append_many(&program_as_machine_code, "\x4D\x3B\x51", 3);
+      append_runtime_field(&program_as_machine_code,
+                           low_water); // cmp r10, [r9 + low_water]
+      nob_da_append_many(&program_as_machine_code, "\x7D\x04", 2); // jge +4
+      nob_da_append_many(&program_as_machine_code, "\x4D\x89\x51", 3);
+      append_runtime_field(&program_as_machine_code,
+                           low_water); // mov [r9 + low_water], r10
+    }
+    if (options.water_marks &&
+        (op->op_kind == OP_RIGHT || op->op_kind == OP_SCAN_RIGHT)) {
+      nob_da_append_many(&program_as_machine_code, "\x4D\x3B\x51", 3);
+      append_runtime_field(&program_as_machine_code,
+                           high_water); // cmp r10, [r9 + high_water]
+      nob_da_append_many(&program_as_machine_code, "\x76\x04", 2); // jbe +4
+      nob_da_append_many(&program_as_machine_code, "\x4D\x89\x51", 3);
+      append_runtime_field(&program_as_machine_code,
+                           high_water); // mov [r9 + high_water], r10
+    }
     //
   }
 
-  nob_da_append(&address_stack, program_as_machine_code.count);
+  cache_flush(&program_as_machine_code, &cache, true);
+  nob_da_append(&address_stack, program_as_machine_code.count);
+
+  for (size_t i = 0; i < back_patches.count; i++) {
+    BackPatch *bp = back_patches.items + i;
+    int32_t src_address = bp->src_byte_address;
+    int32_t dest_address = address_stack.items[bp->dest_op_index - begin];
+    int32_t operand = dest_address - src_address;
+    memcpy(program_as_machine_code.items + bp->operand_byte_address, &operand,
+           sizeof(operand));
+  }
+
+  *code = program_as_machine_code;
+  *patches = label_patches;
+  if (addresses) {
+    size_t count = end - begin;
+    nob_da_append_many(addresses, address_stack.items, count);
+  }
+  nob_da_free(address_stack);
+  nob_da_free(back_patches);
+}
+
+// programs with fewer operators are compiled on one thread
+#define PARALLEL_MIN_OPERATORS (64 * 1024)
+
+// the operators of a big program cut into chunks at the starts of top-level
+// loops, compiled on their own
+typedef struct {
+  Program program;
+  Exec_Options options;
+  Address_Stack starts; // first operator of every chunk, then the end
+  NOB_String_Builder *codes;
+  Label_Patches *label_patches;
+  Address_Stack *addresses; // NULL unless the caller wants them
+} Code_Chunks;
+
+void compile_chunk(void *context, size_t index) {
+  Code_Chunks *chunks = context;
+  operators_to_machine_code(
+      chunks->program, chunks->starts.items[index],
+      chunks->starts.items[index + 1], chunks->options, NULL,
+      chunks->codes + index, chunks->label_patches + index,
+      chunks->addresses ? chunks->addresses + index : NULL);
+}
+
+// compiles the operators of the program in chunks on all cores and appends
+// them to code one after the other. No jump leaves its chunk, only the calls
+// of the helper labels need to be moved along with the chunks.
+void operators_to_machine_code_parallel(Program program, Exec_Options options,
+                                        NOB_String_Builder *code,
+                                        Label_Patches *patches,
+                                        Address_Stack *addresses) {
+  Code_Chunks chunks = {
+      .program = program,
+      .options = options,
+  };
+  size_t chunk_size = program.count / (parallel_threads() * 4) + 1;
+  nob_da_append(&chunks.starts, 0);
+  for (size_t i = 0; i < program.count; i++) {
+    if (program.items[i].op_kind != OP_JMP_IF_ZERO)
+      continue;
+    if (i - chunks.starts.items[chunks.starts.count - 1] >= chunk_size)
+      nob_da_append(&chunks.starts, i);
+    i = program.items[i].operand - 1;
+  }
+  nob_da_append(&chunks.starts, program.count);
+
+  size_t count = chunks.starts.count - 1;
+  chunks.codes = calloc(count, sizeof(*chunks.codes));
+  chunks.label_patches = calloc(count, sizeof(*chunks.label_patches));
+  NOB_ASSERT(chunks.codes != NULL && chunks.label_patches != NULL &&
+             "Buy More RAM LOL");
+  if (addresses) {
+    chunks.addresses = calloc(count, sizeof(*chunks.addresses));
+    NOB_ASSERT(chunks.addresses != NULL && "Buy More RAM LOL");
+  }
+  parallel_for(count, compile_chunk, &chunks);
+
+  size_t total = code->count;
+  for (size_t i = 0; i < count; i++)
+    total += chunks.codes[i].count;
+  if (total > code->capacity) {
+    code->capacity = total;
+    code->items = realloc(code->items, total);
+    NOB_ASSERT(code->items != NULL && "Buy More RAM LOL");
+  }
+  for (size_t i = 0; i < count; i++) {
+    size_t offset = code->count;
+    nob_da_append_many(code, chunks.codes[i].items, chunks.codes[i].count);
+    for (size_t j = 0; j < chunks.label_patches[i].count; j++) {
+      Label_Patch lp = chunks.label_patches[i].items[j];
+      lp.operand_byte_address += offset;
+      lp.src_byte_address += offset;
+      nob_da_append(patches, lp);
+    }
+    for (size_t j = 0; addresses && j < chunks.addresses[i].count; j++)
+      nob_da_append(addresses, chunks.addresses[i].items[j] + offset);
+    nob_da_free(chunks.codes[i]);
+    nob_da_free(chunks.label_patches[i]);
+    if (addresses)
+      nob_da_free(chunks.addresses[i]);
+  }
+  NOB_FREE(chunks.codes);
+  NOB_FREE(chunks.label_patches);
+  NOB_FREE(chunks.addresses);
+  nob_da_free(chunks.starts);
+}
+
+// how far partial evaluation runs a program at compile time, in operators, in
+// cells around the origin and in bytes of output
+#define PREFIX_MAX_STEPS (1 << 16)
+#define PREFIX_MAX_CELLS (16 * 1024)
+#define PREFIX_MAX_OUTPUT (1 << 20)
+
+// a program being run at compile time on a window of the tape around the
+// origin, which it must not leave
+typedef struct {
+  Program program;
+  uint64_t *cells; // of the window
+  size_t low;      // first cell of the tape in the window
+  size_t high;     // first one after it
+  uint64_t mask;   // of the bits of a cell
+  size_t ip;
+  size_t head;
+  size_t depth; // loops the operator at ip is in
+  size_t steps;
+  NOB_String_Builder output;
+} Prefix_Run;
+
+void prefix_run_init(Prefix_Run *run, Program program, Exec_Options options) {
+  memset(run, 0, sizeof(*run));
+  run->program = program;
+  run->low = options.origin > PREFIX_MAX_CELLS / 2
+                 ? options.origin - PREFIX_MAX_CELLS / 2
+                 : 0;
+  run->high = options.memory_size - run->low > PREFIX_MAX_CELLS
+                  ? run->low + PREFIX_MAX_CELLS
+                  : options.memory_size;
+  run->cells = calloc(run->high - run->low, sizeof(*run->cells));
+  NOB_ASSERT(run->cells != NULL && "Buy More RAM LOL");
+  run->mask = options.cell_size == 8
+                  ? UINT64_MAX
+                  : ((uint64_t)1 << options.cell_size * 8) - 1;
+  run->head = options.origin;
+}
+
+void prefix_run_free(Prefix_Run *run) {
+  NOB_FREE(run->cells);
+  nob_da_free(run->output);
+}
+
+// the cell at offset from the pointer, NULL when it is outside of the window
+uint64_t *prefix_cell(Prefix_Run *run, ptrdiff_t offset) {
+  size_t cell = run->head + offset;
+  if (offset < 0 ? run->head - run->low < (size_t)-offset
+                 : cell < run->head || cell >= run->high)
+    return NULL;
+  return run->cells + (cell - run->low);
+}
+
+// runs the operator at ip, false when that can't be done at compile time
+// because it reads input, leaves the window or prints too much, in which case
+// nothing changes. A program that goes off the tape stops the same way and
+// fails once it runs for real.
+bool prefix_step(Prefix_Run *run) {
+  Operator *op = run->program.items + run->ip;
+  uint64_t *cell = NULL;
+  switch (op->op_kind) {
+  case OP_INC:
+  case OP_DEC:
+  case OP_SET:
+    cell = prefix_cell(run, op->offset);
+    if (!cell)
+      return false;
+    if (op->op_kind == OP_INC)
+      *cell = (*cell + op->operand) & run->mask;
+    else if (op->op_kind == OP_DEC)
+      *cell = (*cell - op->operand) & run->mask;
+    else
+      *cell = op->operand & run->mask;
+    break;
+  case OP_LEFT:
+    if (run->head - run->low < op->operand)
+      return false;
+    run->head -= op->operand;
+    break;
+  case OP_RIGHT:
+    if (run->high - run->head <= op->operand)
+      return false;
+    run->head += op->operand;
+    break;
+  case OP_CHECK:
+    if (!prefix_cell(run, op->offset) ||
+        !prefix_cell(run, (ptrdiff_t)op->operand))
+      return false;
+    break;
+  case OP_INPUT:
+    return false;
+  case OP_OUTPUT:
+    cell = prefix_cell(run, op->offset);
+    if (!cell || op->operand > PREFIX_MAX_OUTPUT - run->output.count)
+      return false;
+    for (size_t i = 0; i < op->operand; i++)
+      nob_da_append(&run->output, (char)*cell);
+    break;
+  case OP_MUL: {
+    uint64_t *source = prefix_cell(run, op->source);
+    if (!source)
+      return false;
+    if (*source) {
+      cell = prefix_cell(run, op->offset);
+      if (!cell)
+        return false;
+      *cell = (*cell + *source * op->operand) & run->mask;
+    }
+  } break;
+  case OP_SCAN_LEFT:
+  case OP_SCAN_RIGHT: {
+    size_t head = run->head, steps = run->steps;
+    ptrdiff_t step = op->op_kind == OP_SCAN_LEFT ? -(ptrdiff_t)op->operand
+                                                 : (ptrdiff_t)op->operand;
+    for (cell = prefix_cell(run, 0); cell && *cell;
+         cell = prefix_cell(run, 0)) {
+      run->head += step;
+      run->steps++;
+    }
+    if (!cell) {
+      run->head = head;
+      run->steps = steps;
+      return false;
+    }
+  } break;
+  case OP_JMP_IF_ZERO:
+    cell = prefix_cell(run, 0);
+    if (!cell)
+      return false;
+    if (!*cell) {
+      run->ip = op->operand;
+      run->steps++;
+      return true;
+    }
+    run->depth++;
+    break;
+  case OP_JMP_IF_NON_ZERO:
+    cell = prefix_cell(run, 0);
+    if (!cell)
+      return false;
+    if (*cell) {
+      run->ip = op->operand;
+      run->steps++;
+      return true;
+    }
+    run->depth--;
+    break;
+  default:
+    NOB_ASSERT(0 && "Unreachable");
+  }
+  run->ip++;
+  run->steps++;
+  return true;
+}
+
+// the state a program is in after running its operators before resume at
+// compile time, which read no input. resume is at the top level, so the rest
+// of the program consists of whole loops and can be compiled on its own.
+typedef struct {
+  size_t resume; // 0 when nothing could be run
+  size_t head;
+  size_t low;                // cell the first of cells belongs to
+  NOB_String_Builder cells;  // as they are laid out on the tape, the ones
+                             // around them are all zero
+  NOB_String_Builder output; // printed before resume
+} Prefix;
+
+// runs the program at compile time for as long as it reads no input and stays
+// in the limits, then backs up to the last time it was at the top level
+void prefix_evaluate(Program program, Exec_Options options, Prefix *prefix) {
+  memset(prefix, 0, sizeof(*prefix));
+  Prefix_Run run;
+  prefix_run_init(&run, program, options);
+  size_t top_steps = 0;
+  while (run.ip < program.count && run.steps < PREFIX_MAX_STEPS) {
+    if (run.depth == 0)
+      top_steps = run.steps;
+    if (!prefix_step(&run))
+      break;
+  }
+  if (run.depth != 0) {
+    // the state at the top level is gone, so the run starts over and stops
+    // there this time
+    prefix_run_free(&run);
+    prefix_run_init(&run, program, options);
+    while (run.steps < top_steps && prefix_step(&run))
+      ;
+  }
+
+  size_t count = run.high - run.low;
+  size_t first = 0;
+  while (first < count && !run.cells[first])
+    first++;
+  while (count > first && !run.cells[count - 1])
+    count--;
+  prefix->resume = run.ip;
+  prefix->head = run.head;
+  prefix->low = run.low + first;
+  for (size_t i = first; i < count; i++)
+    nob_da_append_many(&prefix->cells, run.cells + i, options.cell_size);
+  prefix->output = run.output;
+  run.output = (NOB_String_Builder){0};
+  prefix_run_free(&run);
+}
+
+void prefix_free(Prefix *prefix) {
+  nob_da_free(prefix->cells);
+  nob_da_free(prefix->output);
+}
+
+// appends code that stores the bytes of data to where rdi points and advances
+// rdi past them. They go in as immediates since the code can't be read, with
+// zeroed set the destination already holds zeros and those are skipped.
+void append_store(NOB_String_Builder *code, const char *data, size_t count,
+                  bool zeroed) {
+  size_t i = 0;
+  while (i + 8 <= count) {
+    uint64_t value;
+    memcpy(&value, data + i, 8);
+    if (zeroed && !value) {
+      uint32_t skip = 0;
+      for (; i + 8 <= count && skip < INT32_MAX - 8; i += 8, skip += 8) {
+        memcpy(&value, data + i, 8);
+        if (value)
+          break;
+      }
+      nob_da_append_many(code, "\x48\x81\xC7", 3); // add rdi,
+      nob_da_append_many(code, &skip, 4);          // skip
+      continue;
+    }
+    nob_da_append_many(code, "\x48\xB8", 2); // mov rax,
+    nob_da_append_many(code, &value, 8);     // value
+    nob_da_append_many(code, "\x48\xAB", 2); // stosq
+    i += 8;
+  }
+  for (; i < count; i++) {
+    nob_da_append_many(code, "\xB0", 1);   // mov al,
+    nob_da_append_many(code, data + i, 1); // byte
+    nob_da_append_many(code, "\xAA", 1);   // stosb
+  }
+}
+
+// appends code that gets a program started on a zeroed tape into the state
+// prefix left it in. It puts the output of prefix into the output buffer in
+// one go, stores the cells and moves the pointer.
+void append_prefix(NOB_String_Builder *code, Label_Patches *label_patches,
+                   const Prefix *prefix, Exec_Options options) {
+  size_t cell_size = options.cell_size;
+  for (size_t done = 0; done < prefix->output.count;) {
+    size_t left = prefix->output.count - done;
+    uint32_t chunk =
+        left < RUNTIME_BUFFER_CAPACITY ? left : RUNTIME_BUFFER_CAPACITY;
+    uint32_t limit = RUNTIME_BUFFER_CAPACITY - chunk;
+    nob_da_append_many(code, "\x49\x8B\x41", 3);
+    append_runtime_field(code, out_count); // mov rax, [r9 + out_count]
+    nob_da_append_many(code, "\x48\x3D", 2); // cmp rax,
+    nob_da_append_many(code, &limit, 4);     // limit
+    nob_da_append_many(code, "\x76\x0D", 2); // jbe 13
+    nob_da_append_many(code, "\xE8", 1);     // call
+    append_label_operand(code, label_patches, LABEL_FLUSH); // flush
+    nob_da_append_many(code, "\x85\xC0", 2);                // test eax, eax
+    nob_da_append_many(code, "\x0F\x85", 2);                // jnz
+    append_label_operand(code, label_patches, LABEL_IO_ERROR); // io_error
+    // rax holds out_count here, flush leaves 0 in it
+    nob_da_append_many(code, "\x57", 1); // push rdi
+    nob_da_append_many(code, "\x49\x8B\x79", 3);
+    append_runtime_field(code, out_items);       // mov rdi, [r9 + out_items]
+    nob_da_append_many(code, "\x48\x01\xC7", 3); // add rdi, rax
+    nob_da_append_many(code, "\x48\x05", 2);     // add rax,
+    nob_da_append_many(code, &chunk, 4);         // chunk
+    nob_da_append_many(code, "\x49\x89\x41", 3);
+    append_runtime_field(code, out_count); // mov [r9 + out_count], rax
+    append_store(code, prefix->output.items + done, chunk, false);
+    nob_da_append_many(code, "\x5F", 1); // pop rdi
+    done += chunk;
+  }
+
+  // the window of the prefix keeps all of these in reach of 32 bits
+  size_t low = prefix->low;
+  size_t high = prefix->low + prefix->cells.count / cell_size;
+  if (prefix->cells.count) {
+    int32_t offset =
+        ((ptrdiff_t)low - (ptrdiff_t)options.origin) * (ptrdiff_t)cell_size;
+    nob_da_append_many(code, "\x57", 1);         // push rdi
+    nob_da_append_many(code, "\x48\x8D\xBF", 3); // lea rdi, [rdi +
+    nob_da_append_many(code, &offset, 4);        // offset]
+    append_store(code, prefix->cells.items, prefix->cells.count, true);
+    nob_da_append_many(code, "\x5F", 1); // pop rdi
+  }
+  int32_t distance = (ptrdiff_t)prefix->head - (ptrdiff_t)options.origin;
+  int32_t bytes = distance * (int32_t)cell_size;
+  if (distance) {
+    nob_da_append_many(code, "\x49\x81\xC2", 3); // add r10,
+    nob_da_append_many(code, &distance, 4);      // distance
+    nob_da_append_many(code, "\x48\x81\xC7", 3); // add rdi,
+    nob_da_append_many(code, &bytes, 4);         // bytes
+  }
+
+  if (options.water_marks) {
+    // the cells and the pointer have to be within them like everything else
+    // the program does
+    uint64_t low_mark = options.origin, high_mark = options.origin;
+    if (prefix->head < low_mark)
+      low_mark = prefix->head;
+    if (prefix->head > high_mark)
+      high_mark = prefix->head;
+    if (prefix->cells.count && low < low_mark)
+      low_mark = low;
+    if (prefix->cells.count && high - 1 > high_mark)
+      high_mark = high - 1;
+    nob_da_append_many(code, "\x48\xB8", 2); // mov rax,
+    nob_da_append_many(code, &low_mark, 8);  // low_mark
+    nob_da_append_many(code, "\x49\x89\x41", 3);
+    append_runtime_field(code, low_water); // mov [r9 + low_water], rax
+    nob_da_append_many(code, "\x48\xB8", 2); // mov rax,
+    nob_da_append_many(code, &high_mark, 8); // high_mark
+    nob_da_append_many(code, "\x49\x89\x41", 3);
+    append_runtime_field(code, high_water); // mov [r9 + high_water], rax
+  }
+}
+
+// translates the program to machine code. Unless it is a loop the code starts
+// and stops with the pointer at rt->head. With lazy set the top-level loops
+// are left out, each of them becomes a call that compiles the loop when it is
+// first reached. Unless addresses is NULL it gets the offset of every
+// operator in the code followed by the offset right after the last one.
+void program_to_machine_code(Program program, Exec_Options options,
+                             Code_Kind kind, Lazy *lazy,
+                             NOB_String_Builder *machine_code,
+                             Address_Stack *addresses) {
+  NOB_String_Builder program_as_machine_code = {0};
+  Label_Patches label_patches = {0};
+  size_t labels[COUNT_LABELS] = {0};
+  size_t memory_size = options.memory_size;
+  // lazy sites and profile counts go by the operators of the whole program
+  Prefix prefix = {0};
+  if (kind == CODE_PROGRAM && !lazy && !options.profile)
+    prefix_evaluate(program, options, &prefix);
+
+  if (kind != CODE_LOOP) {
+    nob_da_append_many(&program_as_machine_code, "\x49\x89\xF1",
+                       3); // mov r9, rsi
+    nob_da_append_many(&program_as_machine_code, "\x4D\x8B\x51", 3);
+    append_runtime_field(&program_as_machine_code,
+                         head); // mov r10, [r9 + head]
+    nob_da_append_many(&program_as_machine_code, "\x49\xB8", 2); // mov r8,
+    nob_da_append_many(&program_as_machine_code, &memory_size,
+                       8); // memory_size
+  }
+
+  Program rest = program;
+  if (prefix.resume) {
+    // the operators that ran at compile time all start where their result
+    // gets set up
+    for (size_t i = 0; addresses && i < prefix.resume; i++)
+      nob_da_append(addresses, program_as_machine_code.count);
+    append_prefix(&program_as_machine_code, &label_patches, &prefix, options);
+    rest = (Program){0};
+    nob_da_append_many(&rest, program.items + prefix.resume,
+                       (program.count - prefix.resume));
+    link_jumps(&rest);
+  }
+
+  // the call sites of lazy loops go into lazy in order
+  if (lazy || rest.count < PARALLEL_MIN_OPERATORS || parallel_threads() == 1)
+    operators_to_machine_code(rest, 0, rest.count, options, lazy,
+                              &program_as_machine_code, &label_patches,
+                              addresses);
+  else
+    operators_to_machine_code_parallel(rest, options,
+                                       &program_as_machine_code,
+                                       &label_patches, addresses);
+  if (prefix.resume)
+    nob_da_free(rest);
+  prefix_free(&prefix);
+  if (addresses)
+    nob_da_append(addresses, program_as_machine_code.count);
+
+  if (kind != CODE_LOOP) {
+    nob_da_append_many(&program_as_machine_code, "\x4D\x89\x51", 3);
+    append_runtime_field(&program_as_machine_code,
+                         head); // mov [r9 + head], r10
+  }
+  if (kind != CODE_PROGRAM) {
+    // the caller goes on with the buffers as they are
+    nob_da_append_many(&program_as_machine_code, "\x31\xC0",
+                       2);                                    // xor eax, eax
+    nob_da_append_many(&program_as_machine_code, "\xC3", 1); // ret
+  } else {
+    // whatever is left in the output buffer goes out before returning, the
+    // status of the flush is the status of the program
+    nob_da_append_many(&program_as_machine_code, "\xE8", 1); // call
+    append_label_operand(&program_as_machine_code, &label_patches,
+                         LABEL_FLUSH);                      // flush
+    nob_da_append_many(&program_as_machine_code, "\xC3", 1); // ret
+  }
+
+  labels[LABEL_UNDERFLOW] = program_as_machine_code.count;
+  nob_da_append_many(&program_as_machine_code, "\xB8\x01\x00\x00\x00",
+                     5);                                    // mov eax, 1
+  nob_da_append_many(&program_as_machine_code, "\xC3", 1); // ret
+
+  labels[LABEL_OVERFLOW] = program_as_machine_code.count;
+  nob_da_append_many(&program_as_machine_code, "\xB8\x03\x00\x00\x00",
+                     5);                                    // mov eax, 3
+  nob_da_append_many(&program_as_machine_code, "\xC3", 1); // ret
+
+  labels[LABEL_IO_ERROR] = program_as_machine_code.count;
+  nob_da_append_many(&program_as_machine_code, "\xB8\x02\x00\x00\x00",
+                     5);                                    // mov eax, 2
+  nob_da_append_many(&program_as_machine_code, "\xC3", 1); // ret
+
+  labels[LABEL_REFILL] = program_as_machine_code.count;
+  append_hook_call(&program_as_machine_code,
+                   offsetof(Runtime, refill_hook));
+  nob_da_append_many(&program_as_machine_code, "\xE8", 1); // call
+  append_label_operand(&program_as_machine_code, &label_patches,
+                       LABEL_FLUSH); // flush
+  nob_da_append_many(&program_as_machine_code, "\x85\xC0",
+                     2); // test eax, eax
+  nob_da_append_many(&program_as_machine_code, "\x75\x39", 2); // jnz .ret
+  nob_da_append_many(&program_as_machine_code, "\x57", 1);     // push rdi
+  // .again:
+  nob_da_append_many(&program_as_machine_code, "\x31\xC0",
+                     2); // xor eax, eax
+  nob_da_append_many(&program_as_machine_code, "\x41\x8B\x79", 3);
+  append_runtime_field(&program_as_machine_code,
+                       in_fd); // mov edi, [r9 + in_fd]
+  nob_da_append_many(&program_as_machine_code, "\x49\x8B\x71", 3);
+  append_runtime_field(&program_as_machine_code,
+                       in_items); // mov rsi, [r9 + in_items]
+  uint32_t in_capacity = RUNTIME_BUFFER_CAPACITY;
+  nob_da_append_many(&program_as_machine_code, "\xBA", 1); // mov edx,
+  nob_da_append_many(&program_as_machine_code, &in_capacity,
+                     4); // RUNTIME_BUFFER_CAPACITY
+  nob_da_append_many(&program_as_machine_code, "\x0F\x05", 2); // syscall
+  nob_da_append_many(&program_as_machine_code, "\x48\x83\xF8\xFC",
+                     4); // cmp rax, -EINTR
+  nob_da_append_many(&program_as_machine_code, "\x74\xE9", 2); // je .again
+  nob_da_append_many(&program_as_machine_code, "\x49\xC7\x41", 3);
+  append_runtime_field(&program_as_machine_code, in_pos);
+  nob_da_append_many(&program_as_machine_code, "\x00\x00\x00\x00",
+                     4); // mov qword[r9 + in_pos], 0
+  nob_da_append_many(&program_as_machine_code, "\x48\x85\xC0",
+                     3); // test rax, rax
+  nob_da_append_many(&program_as_machine_code, "\x7F\x0D", 2); // jg .filled
+  nob_da_append_many(&program_as_machine_code, "\x31\xC0",
+                     2); // xor eax, eax
+  nob_da_append_many(&program_as_machine_code, "\x49\x89\x41", 3);
+  append_runtime_field(&program_as_machine_code,
+                       in_count); // mov [r9 + in_count], rax
+  nob_da_append_many(&program_as_machine_code, "\xB8\x01\x00\x00\x00",
+                     5);                                    // mov eax, 1
+  nob_da_append_many(&program_as_machine_code, "\x5F", 1); // pop rdi
+  nob_da_append_many(&program_as_machine_code, "\xC3", 1); // ret
+  // .filled:
+  nob_da_append_many(&program_as_machine_code, "\x49\x89\x41", 3);
+  append_runtime_field(&program_as_machine_code,
+                       in_count); // mov [r9 + in_count], rax
+  nob_da_append_many(&program_as_machine_code, "\x31\xC0",
+                     2);                                    // xor eax, eax
+  nob_da_append_many(&program_as_machine_code, "\x5F", 1); // pop rdi
+  // .ret:
+  nob_da_append_many(&program_as_machine_code, "\xC3", 1); // ret
+
+  labels[LABEL_FLUSH] = program_as_machine_code.count;
+  append_hook_call(&program_as_machine_code, offsetof(Runtime, flush_hook));
+  nob_da_append_many(&program_as_machine_code, "\x57", 1); // push rdi
+  nob_da_append_many(&program_as_machine_code, "\x49\x8B\x71", 3);
+  append_runtime_field(&program_as_machine_code,
+                       out_items); // mov rsi, [r9 + out_items]
+  nob_da_append_many(&program_as_machine_code, "\x49\x8B\x51", 3);
+  append_runtime_field(&program_as_machine_code,
+                       out_count); // mov rdx, [r9 + out_count]
+  // .loop:
+  nob_da_append_many(&program_as_machine_code, "\x48\x85\xD2",
+                     3); // test rdx, rdx
+  nob_da_append_many(&program_as_machine_code, "\x74\x18", 2); // jz .done
+  nob_da_append_many(&program_as_machine_code, "\x41\x8B\x79", 3);
+  append_runtime_field(&program_as_machine_code,
+                       out_fd); // mov edi, [r9 + out_fd]
+  nob_da_append_many(&program_as_machine_code, "\xB8\x01\x00\x00\x00",
+                     5);                                          // mov eax, 1
+  nob_da_append_many(&program_as_machine_code, "\x0F\x05", 2); // syscall
+  nob_da_append_many(&program_as_machine_code, "\x48\x85\xC0",
+                     3); // test rax, rax
+  nob_da_append_many(&program_as_machine_code, "\x7E\x14", 2); // jle .fail
+  nob_da_append_many(&program_as_machine_code, "\x48\x01\xC6",
+                     3); // add rsi, rax
+  nob_da_append_many(&program_as_machine_code, "\x48\x29\xC2",
+                     3); // sub rdx, rax
+  nob_da_append_many(&program_as_machine_code, "\xEB\xE3", 2); // jmp .loop
+  // .done:
+  nob_da_append_many(&program_as_machine_code, "\x49\xC7\x41", 3);
+  append_runtime_field(&program_as_machine_code, out_count);
+  nob_da_append_many(&program_as_machine_code, "\x00\x00\x00\x00",
+                     4); // mov qword[r9 + out_count], 0
+  nob_da_append_many(&program_as_machine_code, "\x31\xC0",
+                     2);                                    // xor eax, eax
+  nob_da_append_many(&program_as_machine_code, "\x5F", 1); // pop rdi
+  nob_da_append_many(&program_as_machine_code, "\xC3", 1); // ret
+  // .fail:
+  nob_da_append_many(&program_as_machine_code, "\x48\x83\xF8\xFC",
+                     4); // cmp rax, -EINTR
+  nob_da_append_many(&program_as_machine_code, "\x74\xD1", 2); // je .loop
+  nob_da_append_many(&program_as_machine_code, "\xB8\x02\x00\x00\x00",
+                     5);                                    // mov eax, 2
+  nob_da_append_many(&program_as_machine_code, "\x5F", 1); // pop rdi
+  nob_da_append_many(&program_as_machine_code, "\xC3", 1); // ret
+
+  if (lazy) {
+    // saves the registers of the program around the call of lazy_compile and
+    // goes on in the loop it returns, which comes back to the call site
+    labels[LABEL_LAZY] = program_as_machine_code.count;
+    nob_da_append_many(&program_as_machine_code, "\x41\x52", 2); // push r10
+    nob_da_append_many(&program_as_machine_code, "\x41\x51", 2); // push r9
+    nob_da_append_many(&program_as_machine_code, "\x41\x50", 2); // push r8
+    nob_da_append_many(&program_as_machine_code, "\x57", 1);     // push rdi
+    nob_da_append_many(&program_as_machine_code, "\x53", 1);     // push rbx
+    nob_da_append_many(&program_as_machine_code, "\x48\x89\xE3",
+                       3); // mov rbx, rsp
+    nob_da_append_many(&program_as_machine_code, "\x48\x83\xE4\xF0",
+                       4); // and rsp, -16
+    nob_da_append_many(&program_as_machine_code, "\x48\x8B\x73\x28",
+                       4); // mov rsi, [rbx + 40]
+    void *lazy_compile_address = lazy_compile;
+    nob_da_append_many(&program_as_machine_code, "\x48\xBF", 2); // mov rdi,
+    nob_da_append_many(&program_as_machine_code, &lazy, 8);       // lazy
+    nob_da_append_many(&program_as_machine_code, "\x48\xB8", 2); // mov rax,
+    nob_da_append_many(&program_as_machine_code, &lazy_compile_address,
+                       8); // lazy_compile
+    nob_da_append_many(&program_as_machine_code, "\xFF\xD0", 2); // call rax
+    nob_da_append_many(&program_as_machine_code, "\x48\x89\xDC",
+                       3); // mov rsp, rbx
+    nob_da_append_many(&program_as_machine_code, "\x5B", 1);     // pop rbx
+    nob_da_append_many(&program_as_machine_code, "\x5F", 1);     // pop rdi
+    nob_da_append_many(&program_as_machine_code, "\x41\x58", 2); // pop r8
+    nob_da_append_many(&program_as_machine_code, "\x41\x59", 2); // pop r9
+    nob_da_append_many(&program_as_machine_code, "\x41\x5A", 2); // pop r10
+    nob_da_append_many(&program_as_machine_code, "\x48\x85\xC0",
+                       3); // test rax, rax
+    nob_da_append_many(&program_as_machine_code, "\x74\x02", 2); // jz .fail
+    nob_da_append_many(&program_as_machine_code, "\xFF\xE0", 2); // jmp rax
+    // .fail:
+    nob_da_append_many(&program_as_machine_code, "\xB8\x04\x00\x00\x00",
+                       5);                                    // mov eax, 4
+    nob_da_append_many(&program_as_machine_code, "\xC3", 1); // ret
+  }
+
+  for (size_t i = 0; i < label_patches.count; i++) {
+    Label_Patch *lp = label_patches.items + i;
+    int32_t operand = labels[lp->label] - lp->src_byte_address;
+    memcpy(program_as_machine_code.items + lp->operand_byte_address, &operand,
+           sizeof(operand));
+  }
+
+  *machine_code = program_as_machine_code;
+  nob_da_free(label_patches);
+}
+
+// tells perf which loop of the program the compiled code it samples belongs
+// to, through /tmp/perf-<pid>.map with --perf-map and a jitdump file for
+// perf inject --jit with --jitdump
+static struct {
+  FILE *map;
+  int dump;          // -1 without --jitdump
+  void *dump_marker; // mapping of the dump that perf record notes
+  uint64_t code_index;
+  pthread_mutex_t lock; // code gets compiled on other threads in tiered mode
+} perf = {
+    .dump = -1,
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+};
+
+// layout of a jitdump file from tools/perf/Documentation/jitdump-specification
+#define JITDUMP_MAGIC 0x4A695444
+#define JITDUMP_VERSION 1
+
+typedef enum {
+  JITDUMP_CODE_LOAD = 0,
+  JITDUMP_CODE_CLOSE = 3,
+} Jitdump_Record_Id;
+
+typedef struct {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t total_size;
+  uint32_t elf_mach;
+  uint32_t pad1;
+  uint32_t pid;
+  uint64_t timestamp;
+  uint64_t flags;
+} Jitdump_Header;
+
+typedef struct {
+  uint32_t id;
+  uint32_t total_size;
+  uint64_t timestamp;
+} Jitdump_Record;
+
+// followed by the name with its terminating zero and the code
+typedef struct {
+  Jitdump_Record record;
+  uint32_t pid;
+  uint32_t tid;
+  uint64_t vma;
+  uint64_t code_addr;
+  uint64_t code_size;
+  uint64_t code_index;
+} Jitdump_Code_Load;
+
+// perf record -k mono puts its samples on the same clock
+uint64_t jitdump_timestamp(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec * 1000000000ull + now.tv_nsec;
+}
+
+bool perf_enabled(void) { return perf.map || perf.dump >= 0; }
+
+void perf_end(void) {
+  if (perf.map)
+    fclose(perf.map);
+  if (perf.dump >= 0) {
+    Jitdump_Record close_record = {
+        .id = JITDUMP_CODE_CLOSE,
+        .total_size = sizeof(close_record),
+        .timestamp = jitdump_timestamp(),
+    };
+    write(perf.dump, &close_record, sizeof(close_record));
+    munmap(perf.dump_marker, sysconf(_SC_PAGESIZE));
+    close(perf.dump);
+  }
+}
+
+// opens the files asked for, a file that can't be written is left out
+void perf_begin(bool map, bool dump) {
+  if (map) {
+    const char *path = nob_temp_sprintf("/tmp/perf-%d.map", (int)getpid());
+    perf.map = fopen(path, "w");
+    if (!perf.map)
+      nob_log(NOB_WARNING, "could not create %s: %s", path, str_err_no);
+  }
+  if (dump) {
+    const char *path = nob_temp_sprintf("/tmp/jit-%d.dump", (int)getpid());
+    perf.dump = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    Jitdump_Header header = {
+        .magic = JITDUMP_MAGIC,
+        .version = JITDUMP_VERSION,
+        .total_size = sizeof(header),
+        .elf_mach = EM_X86_64,
+        .pid = getpid(),
+        .timestamp = jitdump_timestamp(),
+    };
+    // perf finds the dump through an executable mapping of it
+    if (perf.dump < 0 ||
+        write(perf.dump, &header, sizeof(header)) != sizeof(header) ||
+        (perf.dump_marker =
+             mmap(NULL, sysconf(_SC_PAGESIZE), PROT_READ | PROT_EXEC,
+                  MAP_PRIVATE, perf.dump, 0)) == MAP_FAILED) {
+      nob_log(NOB_WARNING, "could not create %s: %s", path, str_err_no);
+      if (perf.dump >= 0)
+        close(perf.dump);
+      perf.dump = -1;
+    }
+  }
+  if (perf_enabled())
+    atexit(perf_end);
+}
+
+// names the size bytes of code at code, the jitdump gets a copy of them from
+// bytes since the code itself can't be read. Without bytes only the perf map
+// learns about the code.
+void perf_symbol(const char *name, const char *code, const char *bytes,
+                 size_t size) {
+  if (!size)
+    return;
+  pthread_mutex_lock(&perf.lock);
+  if (perf.map) {
+    fprintf(perf.map, "%lx %zx %s\n", (unsigned long)code, size, name);
+    fflush(perf.map);
+  }
+  if (perf.dump >= 0 && bytes) {
+    size_t name_size = strlen(name) + 1;
+    Jitdump_Code_Load load = {
+        .record =
+            {
+                .id = JITDUMP_CODE_LOAD,
+                .total_size = sizeof(load) + name_size + size,
+                .timestamp = jitdump_timestamp(),
+            },
+        .pid = getpid(),
+        .tid = gettid(),
+        .vma = (uintptr_t)code,
+        .code_addr = (uintptr_t)code,
+        .code_size = size,
+        .code_index = perf.code_index++,
+    };
+    struct iovec parts[] = {
+        {&load, sizeof(load)},
+        {(void *)name, name_size},
+        {(void *)bytes, size},
+    };
+    writev(perf.dump, parts, NOB_ARRAY_LEN(parts));
+  }
+  pthread_mutex_unlock(&perf.lock);
+}
+
+// names the code of the program after the innermost loop every part of it
+// belongs to, bf_loop_<offset of the '[' in the source>. Code outside of
+// loops is bf_main and the helpers after the operators are bf_runtime.
+// addresses holds the offset of every operator in the code and the end of the
+// last one, machine_code what got copied to code.
+void perf_code(Program program, Address_Stack addresses, const char *code,
+               NOB_String_Builder machine_code) {
+  if (!perf_enabled())
+    return;
+  Address_Stack loops = {0}; // '[' of the loops around the operator
+  size_t begin = 0;          // of the code named after owner
+  size_t owner = SIZE_MAX;   // '[' of the innermost loop, SIZE_MAX for none
+  char name[64];
+  for (size_t i = 0; i <= program.count; i++) {
+    size_t next = SIZE_MAX;
+    if (i < program.count) {
+      if (program.items[i].op_kind == OP_JMP_IF_ZERO)
+        nob_da_append(&loops, i);
+      if (loops.count)
+        next = loops.items[loops.count - 1];
+      if (program.items[i].op_kind == OP_JMP_IF_NON_ZERO && loops.count)
+        loops.count--;
+      // the prologue goes with the first operator
+      if (i == 0)
+        owner = next;
+    }
+    if (next == owner && i < program.count)
+      continue;
+    if (owner == SIZE_MAX)
+      snprintf(name, sizeof(name), "bf_main");
+    else
+      snprintf(name, sizeof(name), "bf_loop_%td",
+               program.items[owner].source);
+    perf_symbol(name, code + begin, machine_code.items + begin,
+                addresses.items[i] - begin);
+    begin = addresses.items[i];
+    owner = next;
+  }
+  perf_symbol("bf_runtime", code + begin, machine_code.items + begin,
+              machine_code.count - begin);
+  nob_da_free(loops);
+}
+
+// copies the machine code to executable memory
+bool map_machine_code(NOB_String_Builder machine_code, Code *code) {
+  bool result = true;
+  code->exec = mmap(NULL, machine_code.count,
+                    PROT_EXEC | PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANON, -1, 0);
+  code->len = machine_code.count;
+
+  if (code->exec == MAP_FAILED) {
+    nob_log(NOB_ERROR, "Could not allocate executable memory: %s", str_err_no);
+    nob_return_defer(false);
+  }
+  memcpy(code->exec, machine_code.items, machine_code.count);
+  mprotect(code->exec, machine_code.count, PROT_EXEC);
+
+defer:
+  if (!result)
+    memset(code, 0, sizeof(*code));
+  return result;
+}
+
+bool compile_to_machine_code(Program program, Exec_Options options,
+                             Code_Kind kind, Code *code) {
+  NOB_String_Builder program_as_machine_code = {0};
+  Address_Stack addresses = {0};
+  program_to_machine_code(program, options, kind, NULL,
+                          &program_as_machine_code,
+                          perf_enabled() ? &addresses : NULL);
+  bool result = map_machine_code(program_as_machine_code, code);
+  if (result)
+    perf_code(program, addresses, (const char *)code->exec,
+              program_as_machine_code);
+  nob_da_free(program_as_machine_code);
+  nob_da_free(addresses);
+  return result;
+}
+
+// address space set aside for the code of a lazily compiled program, the loops
+// have to end up in reach of the 32 bit displacement of their call sites
+#define LAZY_CODE_RESERVE ((size_t)1 << 30)
+
+// makes the pages from begin to end accessible as prot
+bool protect_code(char *begin, char *end, int prot) {
+  uintptr_t page_size = sysconf(_SC_PAGESIZE);
+  uintptr_t first = (uintptr_t)begin & ~(page_size - 1);
+  if (mprotect((void *)first, (uintptr_t)end - first, prot) < 0) {
+    nob_log(NOB_ERROR, "could not change the protection of the code: %s",
+            str_err_no);
+    return false;
+  }
+  return true;
+}
+
+// compiles the loop behind the call that returns to return_address, puts it
+// after the code there is and points the call straight to it. Called from the
+// compiled code, returns the loop or NULL when it could not be compiled.
+void *lazy_compile(Lazy *lazy, char *return_address) {
+  size_t offset = return_address - lazy->code;
+  size_t low = 0, high = lazy->sites.count;
+  while (high - low > 1) {
+    size_t middle = low + (high - low) / 2;
+    if (lazy->sites.items[middle].return_address <= offset)
+      low = middle;
+    else
+      high = middle;
+  }
+  Lazy_Site site = lazy->sites.items[low];
+  NOB_ASSERT(site.return_address == offset && "unknown call site");
+
+  Program loop = {0};
+  size_t count = lazy->program.items[site.start].operand - site.start;
+  nob_da_append_many(&loop, lazy->program.items + site.start, count);
+  link_jumps(&loop);
+  Exec_Options options = lazy->options;
+  if (options.profile)
+    options.profile += site.start;
+  NOB_String_Builder loop_as_machine_code = {0};
+  Address_Stack addresses = {0};
+  program_to_machine_code(loop, options, CODE_LOOP, NULL,
+                          &loop_as_machine_code,
+                          perf_enabled() ? &addresses : NULL);
+
+  char *result = NULL;
+  if (lazy->code_size + loop_as_machine_code.count > LAZY_CODE_RESERVE) {
+    nob_log(NOB_ERROR, "ran out of space for compiled code");
+    nob_return_defer(NULL);
+  }
+  char *loop_code = lazy->code + lazy->code_size;
+  char *loop_end = loop_code + loop_as_machine_code.count;
+  if (!protect_code(loop_code, loop_end, PROT_READ | PROT_WRITE))
+    nob_return_defer(NULL);
+  memcpy(loop_code, loop_as_machine_code.items, loop_as_machine_code.count);
+  if (!protect_code(loop_code, loop_end, PROT_EXEC))
+    nob_return_defer(NULL);
+  lazy->code_size += loop_as_machine_code.count;
+  perf_code(loop, addresses, loop_code, loop_as_machine_code);
+
+  int32_t operand = loop_code - return_address;
+  if (!protect_code(return_address - 4, return_address,
+                    PROT_READ | PROT_WRITE))
+    nob_return_defer(NULL);
+  memcpy(return_address - 4, &operand, sizeof(operand));
+  if (!protect_code(return_address - 4, return_address, PROT_EXEC))
+    nob_return_defer(NULL);
+  result = loop_code;
+
+defer:
+  nob_da_free(loop);
+  nob_da_free(loop_as_machine_code);
+  nob_da_free(addresses);
+  return result;
+}
+
+// compiles the program without its top-level loops into the start of a region
+// big enough for the loops to follow
+bool compile_lazily(Program program, Exec_Options options, Lazy *lazy,
+                    Code *code) {
+  memset(lazy, 0, sizeof(*lazy));
+  lazy->program = program;
+  lazy->options = options;
+  NOB_String_Builder program_as_machine_code = {0};
+  Address_Stack addresses = {0};
+  program_to_machine_code(program, options, CODE_PROGRAM, lazy,
+                          &program_as_machine_code,
+                          perf_enabled() ? &addresses : NULL);
+
+  bool result = true;
+  code->len = LAZY_CODE_RESERVE;
+  code->exec = mmap(NULL, code->len, PROT_NONE,
+                    MAP_PRIVATE | MAP_ANON | MAP_NORESERVE, -1, 0);
+  if (code->exec == MAP_FAILED) {
+    nob_log(NOB_ERROR, "Could not allocate executable memory: %s", str_err_no);
+    code->exec = NULL;
+    nob_return_defer(false);
+  }
+  lazy->code = (char *)code->exec;
+  lazy->code_size = program_as_machine_code.count;
+  char *end = lazy->code + lazy->code_size;
+  if (program_as_machine_code.count > LAZY_CODE_RESERVE ||
+      !protect_code(lazy->code, end, PROT_READ | PROT_WRITE))
+    nob_return_defer(false);
+  memcpy(lazy->code, program_as_machine_code.items,
+         program_as_machine_code.count);
+  if (!protect_code(lazy->code, end, PROT_EXEC))
+    nob_return_defer(false);
+  perf_code(program, addresses, lazy->code, program_as_machine_code);
+
+defer:
+  if (!result) {
+    if (code->exec)
+      free_code(*code);
+    memset(code, 0, sizeof(*code));
+    nob_da_free(lazy->sites);
+  }
+  nob_da_free(program_as_machine_code);
+  nob_da_free(addresses);
+  return result;
+}
+
+// a tape and the buffers of a runtime that compiled code runs on, kept in an
+// Instance_Pool between runs
+typedef struct Instance {
+  Tape tape;
+  Runtime rt;
+  struct Instance *next; // while it waits in a pool
+} Instance;
+
+Instance *instance_new(Exec_Options options) {
+  Instance *instance = calloc(1, sizeof(*instance));
+  if (instance == NULL) {
+    nob_log(NOB_ERROR, "could not allocate an instance: %s", str_err_no);
+    return NULL;
+  }
+  if (!tape_alloc(&instance->tape, options)) {
+    nob_log(NOB_ERROR, "could not allocate a tape of %zu bytes: %s",
+            options.memory_size * options.cell_size, str_err_no);
+    free(instance);
+    return NULL;
+  }
+  if (!runtime_init(&instance->rt, options.eof_mode)) {
+    nob_log(NOB_ERROR, "could not allocate the I/O buffers: %s", str_err_no);
+    runtime_free(&instance->rt);
+    tape_free(instance->tape);
+    free(instance);
+    return NULL;
+  }
+  return instance;
+}
+
+void instance_free(Instance *instance) {
+  runtime_free(&instance->rt);
+  tape_free(instance->tape);
+  free(instance);
+}
+
+// runs compiled code of a whole program on the tape of instance, which has to
+// be all zeros, with its input read from in_fd and its output written to
+// out_fd, or going through io instead when that is not NULL
+bool run_instance(Code code, Instance *instance, int in_fd, int out_fd,
+                  const Bfjit_Io *io) {
+  // read again after a guard page fault jumped back into this function
+  volatile bool result = true;
+  Tape *tape = &instance->tape;
+  Runtime *rt = &instance->rt;
+  volatile bool guarded = false;
+  rt->in_fd = in_fd;
+  rt->out_fd = out_fd;
+  rt->io = io;
+  rt->flush_hook = io ? runtime_flush_hook : NULL;
+  rt->refill_hook = io ? runtime_refill_hook : NULL;
+  rt->out_count = 0;
+  rt->in_pos = 0;
+  rt->in_count = 0;
+  rt->low_water = tape->origin;
+  rt->high_water = tape->origin;
+  if (tape->guarded) {
+    if (!guard_begin(tape))
+      nob_return_defer(false);
+    guarded = true;
+    switch (sigsetjmp(guard_fault, 1)) {
+    case 0:
+      break;
+    case GUARD_UNDERFLOW:
+      nob_log(NOB_ERROR, "Memory Underflow");
+      runtime_flush(rt);
+      nob_return_defer(false);
+    case GUARD_OVERFLOW:
+      nob_log(NOB_ERROR, "Memory Overflow");
+      runtime_flush(rt);
+      nob_return_defer(false);
+    }
+  }
+  rt->head = tape->origin;
+  Exec_Status status =
+      code.exec(tape->memory + tape->origin * tape->cell_size, rt);
+  if (!report_exec_status(status)) {
+    // the output produced before the error is still of interest
+    if (status != EXEC_IO_ERROR)
+      runtime_flush(rt);
+    nob_return_defer(false);
+  }
+
+defer:
+  if (guarded)
+    guard_end();
+  return result;
+}
+
+// runs compiled code of a whole program on a fresh tape, see run_instance
+bool run_code(Code code, Exec_Options options, int in_fd, int out_fd,
+              const Bfjit_Io *io) {
+  Instance *instance = instance_new(options);
+  if (!instance)
+    return false;
+  bool result = run_instance(code, instance, in_fd, out_fd, io);
+  instance_free(instance);
+  return result;
+}
+
+// instances left over from earlier runs with the same options. Taking one
+// saves mapping a tape, allocating the buffers and faulting in the pages the
+// runs before touched.
+typedef struct {
+  Exec_Options options;
+  pthread_mutex_t lock;
+  Instance *unused;
+} Instance_Pool;
+
+void instance_pool_init(Instance_Pool *pool, Exec_Options options) {
+  pool->options = options;
+  pthread_mutex_init(&pool->lock, NULL);
+  pool->unused = NULL;
+}
+
+// takes an instance out of the pool or makes a new one when none is left,
+// NULL when that fails
+Instance *instance_acquire(Instance_Pool *pool) {
+  pthread_mutex_lock(&pool->lock);
+  Instance *instance = pool->unused;
+  if (instance)
+    pool->unused = instance->next;
+  pthread_mutex_unlock(&pool->lock);
+  return instance ? instance : instance_new(pool->options);
+}
+
+// zeroes the cells from low to high of the tape of instance, those the run
+// may have written to, and puts it back in the pool for the next one
+void instance_release(Instance_Pool *pool, Instance *instance, size_t low,
+                      size_t high) {
+  tape_reset(&instance->tape, low, high);
+  pthread_mutex_lock(&pool->lock);
+  instance->next = pool->unused;
+  pool->unused = instance;
+  pthread_mutex_unlock(&pool->lock);
+}
+
+void instance_pool_free(Instance_Pool *pool) {
+  while (pool->unused) {
+    Instance *next = pool->unused->next;
+    instance_free(pool->unused);
+    pool->unused = next;
+  }
+  pthread_mutex_destroy(&pool->lock);
+}
+
+bool machine(Program program, Exec_Options options) {
+  Code code = {0};
+  Lazy lazy = {0};
+  stats_enter(PHASE_COMPILE);
+  if (options.lazy)
+    compile_lazily(program, options, &lazy, &code);
+  else
+    compile_to_machine_code(program, options, CODE_PROGRAM, &code);
+  if (!is_valid_code(code))
+    return false;
+  stats_enter(PHASE_RUN);
+  bool result = run_code(code, options, STDIN_FILENO, STDOUT_FILENO, NULL);
+  free_code(code);
+  nob_da_free(lazy.sites);
+  return result;
+}
+
+// parses the source of the program read from file_path
+bool string_to_program(const char *file_path, NOB_String_View source,
+                       Program *program) {
+  bool result = true;
+  Lexer l = {
+      .content = source,
+      .pos = 0,
+  };
+  Address_Stack address_stack = {0};
+  char token = lexer_next(&l);
+  while (token) {
+    switch (token) {
+    case OP_INC:
+    case OP_DEC:
+    case OP_RIGHT:
+    case OP_LEFT:
+    case OP_OUTPUT:
+    case OP_INPUT: {
+      size_t count = 1;
+      char operator_tmp = lexer_next(&l);
+      while (operator_tmp == token) {
+        count++;
+        operator_tmp = lexer_next(&l);
+      }
+      Operator op = {
+          .op_kind = token,
+          .operand = count,
+      };
+      program_append(program, op);
+      token = operator_tmp;
+    } break;
+    case OP_JMP_IF_ZERO: {
+      size_t address = program->count;
+      Operator op = {
+          .op_kind = token,
+          .operand = 0,
+          .source = l.pos - 1,
+      };
+
+      nob_da_append(program, op);
+      nob_da_append(&address_stack, address);
+
+      token = lexer_next(&l);
+    } break;
+    case OP_JMP_IF_NON_ZERO: {
+      if (!address_stack.count) {
+        nob_log(NOB_ERROR, "%s [%zu]: Unbalanced jump", file_path, l.pos);
+        nob_return_defer(false);
+      }
+
+      size_t address = address_stack.items[--address_stack.count];
+
+      Operator *body = program->items + address + 1;
+      if (program->count == address + 2 &&
+          (body->op_kind == OP_INC || body->op_kind == OP_DEC) &&
+          body->operand % 2) {
+        // an odd step reaches zero from every value, so `[-]`, `[+]` and
+        // friends clear the byte no matter how often they'd go around
+        program->count = address;
+        Operator op = {
+            .op_kind = OP_SET,
+            .operand = 0,
+        };
+        nob_da_append(program, op);
+        token = lexer_next(&l);
+        break;
+      }
+      if (program->count == address + 2 &&
+          (body->op_kind == OP_LEFT || body->op_kind == OP_RIGHT) &&
+          body->operand <= RUN_MAX_OFFSET) {
+        // `[>]`, `[<<]`, ... look for the next zero byte
+        Operator op = {
+            .op_kind =
+                body->op_kind == OP_LEFT ? OP_SCAN_LEFT : OP_SCAN_RIGHT,
+            .operand = body->operand,
+        };
+        program->count = address;
+        nob_da_append(program, op);
+        token = lexer_next(&l);
+        break;
+      }
+
+      Operator op = {
+          .op_kind = token,
+          .operand = address + 1,
+      };
+
+      nob_da_append(program, op);
+      program->items[address].operand = program->count;
+
+      token = lexer_next(&l);
+
+    } break;
+    default:
+      NOB_ASSERT(0 && "Unreachable");
+    }
+  }
+
+  if (address_stack.count) {
+    nob_log(NOB_ERROR, "%s: Unbalanced jump", file_path);
+    nob_return_defer(false);
+  }
+
+defer:
+  nob_da_free(address_stack);
+  if (!result) {
+    nob_da_free(*program);
+    memset(program, 0, sizeof(*program));
+  }
+  return result;
+}
+
+// the largest distance a multiply loop may reach, keeps offsets in the range
+// of a 32 bit displacement
+#define MUL_LOOP_MAX_OFFSET 1024
+
+// turns loops that only add to bytes around the counter, come back to where
+// they started and count the current byte down (or up) by one into a series
+// of OP_MUL followed by clearing the counter. `[->+>++<<]` adds the current
+// byte to the next one and twice of it to the one after.
+void optimize_multiply_loops(Program *program) {
+  Program optimized = {0};
+  for (size_t i = 0; i < program->count; i++) {
+    Operator *op = program->items + i;
+    if (op->op_kind != OP_JMP_IF_ZERO) {
+      program_append(&optimized, *op);
+      continue;
+    }
+
+    size_t end = op->operand - 1;
+    // change of every cell in the reach of the loop, centered on the counter,
+    // at the widest cells so the loop comes out the same for all of them
+    uint64_t deltas[2 * MUL_LOOP_MAX_OFFSET + 1] = {0};
+    ptrdiff_t offset = 0, min_offset = 0, max_offset = 0;
+    bool simple = true;
+    for (size_t j = i + 1; simple && j < end; j++) {
+      Operator *body = program->items + j;
+      switch (body->op_kind) {
+      case OP_INC:
+        deltas[MUL_LOOP_MAX_OFFSET + offset] += body->operand;
+        break;
+      case OP_DEC:
+        deltas[MUL_LOOP_MAX_OFFSET + offset] -= body->operand;
+        break;
+      case OP_LEFT:
+      case OP_RIGHT:
+        if (body->operand > MUL_LOOP_MAX_OFFSET) {
+          simple = false;
+          break;
+        }
+        offset += body->op_kind == OP_LEFT ? -(ptrdiff_t)body->operand
+                                           : (ptrdiff_t)body->operand;
+        if (offset < -MUL_LOOP_MAX_OFFSET || offset > MUL_LOOP_MAX_OFFSET)
+          simple = false;
+        if (offset < min_offset)
+          min_offset = offset;
+        if (offset > max_offset)
+          max_offset = offset;
+        break;
+      default:
+        simple = false;
+      }
+    }
+    uint64_t step = deltas[MUL_LOOP_MAX_OFFSET];
+    if (!simple || offset != 0 || (step != 1 && step != (uint64_t)-1)) {
+      nob_da_append(&optimized, *op);
+      continue;
+    }
+
+    // counting up from v takes 2^bits - v steps, same as adding -v times
+    for (ptrdiff_t o = min_offset; o <= max_offset; o++) {
+      uint64_t delta = deltas[MUL_LOOP_MAX_OFFSET + o];
+      // the ends of the reach stay in even without a change to them, the
+      // bounds check of the OP_MUL is what the loop did by moving there
+      if (o == 0 || (!delta && o != min_offset && o != max_offset))
+        continue;
+      Operator mul = {
+          .op_kind = OP_MUL,
+          .operand = step == 1 ? -delta : delta,
+          .offset = o,
+      };
+      nob_da_append(&optimized, mul);
+    }
+    Operator clear = {
+        .op_kind = OP_SET,
+        .operand = 0,
+    };
+    nob_da_append(&optimized, clear);
+    i = end;
+  }
+  link_jumps(&optimized);
+  nob_da_free(*program);
+  *program = optimized;
+}
+
+// operators addressing relative to the pointer while its moves are deferred
+typedef struct {
+  Program ops;
+  ptrdiff_t offset;       // where the moves so far would have left the pointer
+  ptrdiff_t low, high;    // reach of the run
+  ptrdiff_t checked_low;  // reach covered by the checks appended for it so
+  ptrdiff_t checked_high; // far
+} Run;
+
+// appends the operators of the run so far, guarded by the check of all the
+// bytes it reaches unless an earlier check of the run covers them already
+void flush_run(Program *program, Run *run) {
+  if (run->low < run->checked_low || run->high > run->checked_high) {
+    Operator check = {
+        .op_kind = OP_CHECK,
+        .operand = run->high,
+        .offset = run->low,
+    };
+    nob_da_append(program, check);
+    run->checked_low = run->low;
+    run->checked_high = run->high;
+  }
+  for (size_t i = 0; i < run->ops.count; i++)
+    program_append(program, run->ops.items[i]);
+  run->ops.count = 0;
+}
+
+// appends the rest of the run followed by the one move that brings the
+// pointer to where the moves in the run would have left it
+void end_run(Program *program, Run *run) {
+  flush_run(program, run);
+  if (run->offset) {
+    Operator move = {
+        .op_kind = run->offset < 0 ? OP_LEFT : OP_RIGHT,
+        .operand = run->offset < 0 ? -run->offset : run->offset,
+    };
+    nob_da_append(program, move);
+  }
+  run->offset = run->low = run->high = 0;
+  run->checked_low = run->checked_high = 0;
+}
+
+// defers the moves of the pointer between two jumps or scans, the operators in
+// between address their byte relative to where the pointer would be. `>>+<<-`
+// ends up touching both bytes without moving the pointer at all. Input and
+// output go out before the check of any move after them, so a program that
+// runs off the tape still does all of its I/O up to there.
+void optimize_pointer_moves(Program *program) {
+  Program optimized = {0};
+  Run run = {0};
+  for (size_t i = 0; i < program->count; i++) {
+    Operator op = program->items[i];
+    switch (op.op_kind) {
+    case OP_LEFT:
+    case OP_RIGHT: {
+      ptrdiff_t next = run.offset;
+      if (op.operand <= RUN_MAX_OFFSET)
+        next += op.op_kind == OP_LEFT ? -(ptrdiff_t)op.operand
+                                      : (ptrdiff_t)op.operand;
+      if (op.operand > RUN_MAX_OFFSET || next < -RUN_MAX_OFFSET ||
+          next > RUN_MAX_OFFSET) {
+        // too far for a displacement, end the run and really move
+        end_run(&optimized, &run);
+        nob_da_append(&optimized, op);
+        break;
+      }
+      run.offset = next;
+      if (run.offset < run.low)
+        run.low = run.offset;
+      if (run.offset > run.high)
+        run.high = run.offset;
+    } break;
+    case OP_INC:
+    case OP_DEC:
+    case OP_SET:
+    case OP_INPUT:
+    case OP_OUTPUT:
+    case OP_MUL: {
+      // an OP_MUL checks the byte it adds to by itself, it doesn't touch it
+      // when the byte it multiplies is zero
+      op.offset += run.offset;
+      op.source += run.offset;
+      nob_da_append(&run.ops, op);
+      if (op.op_kind == OP_INPUT || op.op_kind == OP_OUTPUT)
+        flush_run(&optimized, &run);
+    } break;
+    default: {
+      end_run(&optimized, &run);
+      nob_da_append(&optimized, op);
+    }
+    }
+  }
+  end_run(&optimized, &run);
+  link_jumps(&optimized);
+  nob_da_free(run.ops);
+  nob_da_free(*program);
+  *program = optimized;
+}
+
+void optimize_program(Program *program) {
+  optimize_multiply_loops(program);
+  optimize_pointer_moves(program);
+}
+
+// smaller sources are parsed on one thread
+#define PARALLEL_MIN_SOURCE (1024 * 1024)
+
+// the source of a big program cut into pieces right before top-level loops,
+// each of them is parsed and optimized on its own
+typedef struct {
+  const char *file_path;
+  NOB_String_View source;
+  Address_Stack starts; // offset of every piece in the source, then the end
+  Program *programs;
+  bool *parsed;
+} Source_Chunks;
+
+void parse_chunk(void *context, size_t index) {
+  Source_Chunks *chunks = context;
+  size_t start = chunks->starts.items[index];
+  NOB_String_View piece = nob_sv_from_parts(
+      chunks->source.data + start, chunks->starts.items[index + 1] - start);
+  Program *program = chunks->programs + index;
+  chunks->parsed[index] = string_to_program(chunks->file_path, piece, program);
+  if (chunks->parsed[index])
+    optimize_program(program);
+}
+
+// cuts the source into pieces that hold whole loops, parses and optimizes
+// them on all cores and puts them together with their jumps moved to where
+// they end up. The program does the same as when parsed in one go, though not
+// always with the same operators: moves right before a piece that starts with
+// a loop turned into a multiply or a clear go out as moves of their own
+// instead of into its offsets. Fails quietly on sources the parser would
+// reject.
+bool parse_in_pieces(const char *file_path, NOB_String_View source,
+                     Program *program) {
+  bool result = true;
+  Source_Chunks chunks = {
+      .file_path = file_path,
+      .source = source,
+  };
+
+  size_t chunk_size = source.count / (parallel_threads() * 4) + 1;
+  size_t depth = 0;
+  nob_da_append(&chunks.starts, 0);
+  for (size_t i = 0; i < source.count; i++) {
+    if (source.data[i] == '[') {
+      if (!depth &&
+          i - chunks.starts.items[chunks.starts.count - 1] >= chunk_size)
+        nob_da_append(&chunks.starts, i);
+      depth++;
+    } else if (source.data[i] == ']') {
+      // unbalanced, the parser has to find out where
+      if (!depth)
+        nob_return_defer(false);
+      depth--;
+    }
+  }
+  if (depth)
+    nob_return_defer(false);
+  nob_da_append(&chunks.starts, source.count);
+
+  size_t count = chunks.starts.count - 1;
+  chunks.programs = calloc(count, sizeof(*chunks.programs));
+  chunks.parsed = calloc(count, sizeof(*chunks.parsed));
+  NOB_ASSERT(chunks.programs != NULL && chunks.parsed != NULL &&
+             "Buy More RAM LOL");
+  parallel_for(count, parse_chunk, &chunks);
+
+  size_t total = 0;
+  for (size_t i = 0; i < count; i++) {
+    if (!chunks.parsed[i])
+      nob_return_defer(false);
+    total += chunks.programs[i].count;
+  }
+  program->capacity = total;
+  program->items = realloc(program->items, total * sizeof(*program->items));
+  NOB_ASSERT(program->items != NULL && "Buy More RAM LOL");
+  for (size_t i = 0; i < count; i++) {
+    size_t offset = program->count;
+    Program *piece = chunks.programs + i;
+    for (size_t j = 0; j < piece->count; j++) {
+      if (piece->items[j].op_kind == OP_JMP_IF_ZERO)
+        piece->items[j].source += chunks.starts.items[i];
+      if (piece->items[j].op_kind == OP_JMP_IF_ZERO ||
+          piece->items[j].op_kind == OP_JMP_IF_NON_ZERO)
+        piece->items[j].operand += offset;
+    }
+    nob_da_append_many(program, piece->items, piece->count);
+  }
+
+defer:
+  for (size_t i = 0; chunks.programs && i < chunks.starts.count - 1; i++)
+    nob_da_free(chunks.programs[i]);
+  NOB_FREE(chunks.programs);
+  NOB_FREE(chunks.parsed);
+  nob_da_free(chunks.starts);
+  if (!result) {
+    nob_da_free(*program);
+    memset(program, 0, sizeof(*program));
+  }
+  return result;
+}
+
+// parses and optimizes the program, in pieces on all cores if it is big
+bool parse_program(const char *file_path, NOB_String_View source,
+                   Program *program) {
+  if (source.count >= PARALLEL_MIN_SOURCE && parallel_threads() > 1 &&
+      parse_in_pieces(file_path, source, program))
+    return true;
+  if (!string_to_program(file_path, source, program))
+    return false;
+  optimize_program(program);
+  return true;
+}
+
+// the text of a program, mapped straight from its file when it is a regular
+// one and read into memory from anything else like a pipe
+typedef struct {
+  NOB_String_View text;
+  bool mapped;
+} Source;
+
+// reads what is left of fd into memory
+bool read_source(int fd, Source *source) {
+  NOB_String_Builder buffer = {0};
+  char chunk[64 * 1024];
+  for (;;) {
+    ssize_t n = read(fd, chunk, sizeof(chunk));
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n < 0) {
+      nob_sb_free(buffer);
+      return false;
+    }
+    if (n == 0)
+      break;
+    nob_sb_append_buf(&buffer, chunk, (size_t)n);
+  }
+  source->text = nob_sv_from_parts(buffer.items, buffer.count);
+  source->mapped = false;
+  return true;
+}
+
+// the lexer goes over the source once from start to end, the pages of a
+// mapping are read ahead and dropped behind it
+bool source_open(const char *file_path, Source *source) {
+  bool result = true;
+  memset(source, 0, sizeof(*source));
+  int fd = open(file_path, O_RDONLY);
+  if (fd < 0)
+    return false;
+  struct stat st;
+  if (fstat(fd, &st) < 0)
+    nob_return_defer(false);
+  if (!S_ISREG(st.st_mode))
+    nob_return_defer(read_source(fd, source));
+  // an empty file can't be mapped, there is nothing in it to parse anyway
+  if (!st.st_size)
+    nob_return_defer(true);
+  void *text = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (text == MAP_FAILED)
+    nob_return_defer(read_source(fd, source));
+  madvise(text, st.st_size, MADV_SEQUENTIAL);
+  source->text = nob_sv_from_parts(text, st.st_size);
+  source->mapped = true;
+
+defer:
+  close(fd);
+  return result;
+}
+
+void source_close(Source source) {
+  if (source.mapped)
+    munmap((void *)source.text.data, source.text.count);
+  else
+    NOB_FREE((void *)source.text.data);
+}
+
+typedef struct {
+  const char *file_path;
+  enum { MACHINE, INTERPRET, TIERED } mode;
+  Exec_Options exec;
+  const char *cache_dir;   // keeps compiled code around for the next run
+  const char *output_path; // where to write an executable instead of running
+  bool stats;              // print where the time went on exit
+  bool profile;            // count the runs of every loop body
+  bool perf_map;           // name the compiled code for perf in a perf map
+  bool jitdump;            // and in a jitdump with the code itself
+  const char *batch_path;  // manifest of jobs to run instead of file_path
+  size_t threads;          // that run the jobs of a batch
+  bool bidirectional;      // start in the middle of the tape
+} Options;
+
+// where the executables written by -o get loaded
+#define EXECUTABLE_BASE 0x400000
+
+// room for _start and its messages, which need to know where the bss is
+// before they are written
+#define EXECUTABLE_START_SIZE 1024
+
+static const struct {
+  Exec_Status status;
+  const char *message;
+} executable_messages[] = {
+    {EXEC_UNDERFLOW, "[ERROR] Memory Underflow\n"},
+    {EXEC_OVERFLOW, "[ERROR] Memory Overflow\n"},
+    {EXEC_IO_ERROR, "[ERROR] could not write output\n"},
+};
+
+// wraps the code of a whole program into a static ELF executable that needs
+// nothing but the kernel. Its _start sets up the runtime in the bss, calls
+// the code and exits with the Exec_Status, printing what went wrong like the
+// jit does.
+bool write_executable(const char *path, NOB_String_Builder machine_code,
+                      Exec_Options options) {
+  size_t headers_size = sizeof(Elf64_Ehdr) + 3 * sizeof(Elf64_Phdr);
+  size_t start_offset = headers_size + machine_code.count;
+  start_offset = (start_offset + 15) & ~(size_t)15;
+
+  // the bss begins on the page after the code
+  uint64_t bss_start =
+      (EXECUTABLE_BASE + start_offset + EXECUTABLE_START_SIZE + 0xfff) &
+      ~(uint64_t)0xfff;
+  uint64_t runtime = bss_start;
+  uint64_t out_buffer = runtime + 128;
+  uint64_t in_buffer = out_buffer + RUNTIME_BUFFER_CAPACITY;
+  uint64_t tape = in_buffer + RUNTIME_BUFFER_CAPACITY + TAPE_PADDING;
+  uint64_t bss_end =
+      tape + options.memory_size * options.cell_size + TAPE_PADDING;
+
+  NOB_String_Builder start = {0};
+  nob_da_append_many(&start, "\x48\xBE", 2);     // mov rsi,
+  nob_da_append_many(&start, &runtime, 8);      // runtime
+  nob_da_append_many(&start, "\x48\xB8", 2);     // mov rax,
+  nob_da_append_many(&start, &out_buffer, 8);   // out_buffer
+  nob_da_append_many(&start, "\x48\x89\x46", 3);
+  append_runtime_field(&start, out_items); // mov [rsi + out_items], rax
+  nob_da_append_many(&start, "\x48\xB8", 2);     // mov rax,
+  nob_da_append_many(&start, &in_buffer, 8);    // in_buffer
+  nob_da_append_many(&start, "\x48\x89\x46", 3);
+  append_runtime_field(&start, in_items); // mov [rsi + in_items], rax
+  nob_da_append_many(&start, "\xC7\x46", 2);
+  append_runtime_field(&start, out_fd);
+  nob_da_append_many(&start, "\x01\x00\x00\x00",
+                     4); // mov dword[rsi + out_fd], STDOUT_FILENO
+  uint32_t eof_mode = options.eof_mode;
+  nob_da_append_many(&start, "\xC7\x46", 2);
+  append_runtime_field(&start, eof_mode);
+  nob_da_append_many(&start, &eof_mode,
+                     4); // mov dword[rsi + eof_mode], eof_mode
+  uint64_t origin = options.origin;
+  nob_da_append_many(&start, "\x48\xB8", 2); // mov rax,
+  nob_da_append_many(&start, &origin, 8);   // origin
+  nob_da_append_many(&start, "\x48\x89\x46", 3);
+  append_runtime_field(&start, head); // mov [rsi + head], rax
+  uint64_t tape_origin = tape + origin * options.cell_size;
+  nob_da_append_many(&start, "\x48\xBF", 2);   // mov rdi,
+  nob_da_append_many(&start, &tape_origin, 8); // tape + origin
+  nob_da_append_many(&start, "\xE8", 1);     // call
+  int32_t code_operand = headers_size - (start_offset + start.count + 4);
+  nob_da_append_many(&start, &code_operand, 4); // code
+  nob_da_append_many(&start, "\x89\xC3", 2);     // mov ebx, eax
+  nob_da_append_many(&start, "\x85\xC0", 2);     // test eax, eax
+  nob_da_append_many(&start, "\x0F\x84\x00\x00\x00\x00", 6); // jz .exit
+  size_t jz_exit = start.count;
+  nob_da_append_many(&start, "\x83\xF8\x02", 3); // cmp eax, 2
+  nob_da_append_many(&start, "\x74\x00", 2);     // je .message
+  size_t je_message = start.count;
+  // what the program printed before the error still goes out
+  nob_da_append_many(&start, "\x49\xB9", 2); // mov r9,
+  nob_da_append_many(&start, &runtime, 8);  // runtime
+  nob_da_append_many(&start, "\x49\x8B\x71", 3);
+  append_runtime_field(&start, out_items); // mov rsi, [r9 + out_items]
+  nob_da_append_many(&start, "\x49\x8B\x51", 3);
+  append_runtime_field(&start, out_count); // mov rdx, [r9 + out_count]
+  size_t flush = start.count;
+  // .flush:
+  nob_da_append_many(&start, "\x48\x85\xD2", 3); // test rdx, rdx
+  nob_da_append_many(&start, "\x74\x00", 2);     // jz .message
+  size_t jz_message = start.count;
+  nob_da_append_many(&start, "\xBF\x01\x00\x00\x00",
+                     5); // mov edi, STDOUT_FILENO
+  nob_da_append_many(&start, "\xB8\x01\x00\x00\x00", 5); // mov eax, 1
+  nob_da_append_many(&start, "\x0F\x05", 2);             // syscall
+  nob_da_append_many(&start, "\x48\x83\xF8\xFC", 4);     // cmp rax, -EINTR
+  append_jump_back(&start, "\x74", flush);               // je .flush
+  nob_da_append_many(&start, "\x48\x85\xC0", 3);         // test rax, rax
+  nob_da_append_many(&start, "\x7E\x00", 2);             // jle .message
+  size_t jle_message = start.count;
+  nob_da_append_many(&start, "\x48\x01\xC6", 3); // add rsi, rax
+  nob_da_append_many(&start, "\x48\x29\xC2", 3); // sub rdx, rax
+  append_jump_back(&start, "\xEB", flush);       // jmp .flush
+  // .message:
+  patch_rel8(&start, je_message);
+  patch_rel8(&start, jz_message);
+  patch_rel8(&start, jle_message);
+  size_t message_count = NOB_ARRAY_LEN(executable_messages);
+  size_t jmp_write[NOB_ARRAY_LEN(executable_messages)];
+  size_t message_operands[NOB_ARRAY_LEN(executable_messages)];
+  for (size_t i = 0; i < message_count; i++) {
+    uint8_t status = executable_messages[i].status;
+    uint32_t length = strlen(executable_messages[i].message);
+    nob_da_append_many(&start, "\x83\xFB", 2); // cmp ebx,
+    nob_da_append(&start, (char)status);      // status
+    nob_da_append_many(&start, "\x75\x00", 2); // jne .next
+    size_t jne_next = start.count;
+    nob_da_append_many(&start, "\x48\xBE", 2); // mov rsi,
+    message_operands[i] = start.count;
+    nob_da_append_many(&start, "\x00\x00\x00\x00\x00\x00\x00\x00",
+                       8);                    // message
+    nob_da_append_many(&start, "\xBA", 1);    // mov edx,
+    nob_da_append_many(&start, &length, 4);  // length
+    nob_da_append_many(&start, "\xEB\x00", 2); // jmp .write
+    jmp_write[i] = start.count;
+    // .next:
+    patch_rel8(&start, jne_next);
+  }
+  nob_da_append_many(&start, "\xEB\x00", 2); // jmp .exit
+  size_t jmp_exit = start.count;
+  // .write:
+  for (size_t i = 0; i < message_count; i++)
+    patch_rel8(&start, jmp_write[i]);
+  nob_da_append_many(&start, "\xBF\x02\x00\x00\x00",
+                     5); // mov edi, STDERR_FILENO
+  nob_da_append_many(&start, "\xB8\x01\x00\x00\x00", 5); // mov eax, 1
+  nob_da_append_many(&start, "\x0F\x05", 2);             // syscall
+  // .exit:
+  patch_rel32(&start, jz_exit);
+  patch_rel8(&start, jmp_exit);
+  nob_da_append_many(&start, "\x89\xDF", 2);             // mov edi, ebx
+  nob_da_append_many(&start, "\xB8\xE7\x00\x00\x00", 5); // mov eax, 231
+  nob_da_append_many(&start, "\x0F\x05", 2);             // syscall
+  for (size_t i = 0; i < message_count; i++) {
+    uint64_t address = EXECUTABLE_BASE + start_offset + start.count;
+    memcpy(start.items + message_operands[i], &address, 8);
+    const char *message = executable_messages[i].message;
+    nob_da_append_many(&start, message, strlen(message));
+  }
+  NOB_ASSERT(start.count <= EXECUTABLE_START_SIZE && "_start grew too big");
+  size_t text_size = start_offset + start.count;
+
+  Elf64_Ehdr header = {
+      .e_ident = {ELFMAG0, ELFMAG1, ELFMAG2, ELFMAG3, ELFCLASS64, ELFDATA2LSB,
+                  EV_CURRENT, ELFOSABI_SYSV},
+      .e_type = ET_EXEC,
+      .e_machine = EM_X86_64,
+      .e_version = EV_CURRENT,
+      .e_entry = EXECUTABLE_BASE + start_offset,
+      .e_phoff = sizeof(Elf64_Ehdr),
+      .e_ehsize = sizeof(Elf64_Ehdr),
+      .e_phentsize = sizeof(Elf64_Phdr),
+      .e_phnum = 3,
+  };
+  Elf64_Phdr segments[3] = {
+      {
+          .p_type = PT_LOAD,
+          .p_flags = PF_R | PF_X,
+          .p_offset = 0,
+          .p_vaddr = EXECUTABLE_BASE,
+          .p_paddr = EXECUTABLE_BASE,
+          .p_filesz = text_size,
+          .p_memsz = text_size,
+          .p_align = 0x1000,
+      },
+      {
+          // nothing of it is in the file, the kernel hands out zeroed pages
+          .p_type = PT_LOAD,
+          .p_flags = PF_R | PF_W,
+          .p_offset = 0,
+          .p_vaddr = bss_start,
+          .p_paddr = bss_start,
+          .p_filesz = 0,
+          .p_memsz = bss_end - bss_start,
+          .p_align = 0x1000,
+      },
+      {
+          .p_type = PT_GNU_STACK,
+          .p_flags = PF_R | PF_W,
+      },
+  };
+
+  NOB_String_Builder executable = {0};
+  nob_da_append_many(&executable, &header, sizeof(header));
+  nob_da_append_many(&executable, segments, sizeof(segments));
+  nob_da_append_many(&executable, machine_code.items, machine_code.count);
+  while (executable.count < start_offset)
+    nob_da_append(&executable, '\xCC'); // int3
+  nob_da_append_many(&executable, start.items, start.count);
+  nob_da_free(start);
+
+  bool result = true;
+  int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0755);
+  if (fd < 0) {
+    nob_log(NOB_ERROR, "could not create %s: %s", path, str_err_no);
+    nob_return_defer(false);
+  }
+  if (write(fd, executable.items, executable.count) !=
+      (ssize_t)executable.count) {
+    nob_log(NOB_ERROR, "could not write %s: %s", path, str_err_no);
+    close(fd);
+    nob_return_defer(false);
+  }
+  if (close(fd) < 0) {
+    nob_log(NOB_ERROR, "could not write %s: %s", path, str_err_no);
+    nob_return_defer(false);
+  }
+
+defer:
+  nob_da_free(executable);
+  return result;
+}
 
-  for (size_t i = 0; i < back_patches.count; i++) {
-    BackPatch *bp = back_patches.items + i;
-    int32_t src_address = bp->src_byte_address;
-    int32_t dest_address = address_stack.items[bp->dest_op_index];
-    int32_t operand = dest_address - src_address;
-    memcpy(program_as_machine_code.items + bp->operand_byte_address, &operand,
-           sizeof(operand));
+// code in the cache is only ever used by the build of bf-jit that made it
+static const char code_cache_version[] = "bf-jit " __DATE__ " " __TIME__;
+
+// where the code starts in a cache file, the header before it is padded to a
+// page so the code can be mapped on its own
+#define CODE_CACHE_CODE_OFFSET 4096
+
+typedef struct {
+  char magic[8];
+  uint64_t key;
+  uint64_t code_size;
+  uint64_t checksum; // of the code, a damaged file is not run
+} Code_Cache_Header;
+
+static const char code_cache_magic[8] = "bfjitc\0\2";
+
+uint64_t fnv1a(uint64_t hash, const void *data, size_t size) {
+  const unsigned char *bytes = data;
+  for (size_t i = 0; i < size; i++) {
+    hash ^= bytes[i];
+    hash *= 0x100000001b3;
   }
+  return hash;
+}
 
-  nob_da_append_many(&program_as_machine_code, "\x48\x31\xC0",
-                     3);                                // xor rax, rax
-  nob_sb_append_cstr(&program_as_machine_code, "\xC3"); // ret
+// hashes everything the compiled code depends on: the source, the options
+// that change the code, the cpu features it was made for and the build
+uint64_t code_cache_key(NOB_String_View source, Exec_Options options) {
+  uint64_t hash = 0xcbf29ce484222325;
+  hash = fnv1a(hash, code_cache_version, sizeof(code_cache_version));
+  uint64_t sizes[3] = {options.memory_size, options.origin, options.cell_size};
+  bool flags[3] = {
+      options.unchecked,
+      options.cache_cells,
+      __builtin_cpu_supports("avx2"),
+  };
+  hash = fnv1a(hash, sizes, sizeof(sizes));
+  hash = fnv1a(hash, flags, sizeof(flags));
+  return fnv1a(hash, source.data, source.count);
+}
 
-  bool result = true;
-  code->exec =
-      mmap(NULL, program_as_machine_code.count,
-           PROT_EXEC | PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
-  code->len = program_as_machine_code.count;
+uint64_t code_cache_checksum(const void *code, size_t size) {
+  return fnv1a(0xcbf29ce484222325, code, size);
+}
 
+// maps the code stored under key at path, fails quietly when there is none
+// and warns when it is damaged
+bool code_cache_load(const char *path, uint64_t key, Code *code) {
+  bool result = true;
+  int fd = open(path, O_RDONLY);
+  if (fd < 0)
+    return false;
+  Code_Cache_Header header;
+  struct stat st;
+  if (pread(fd, &header, sizeof(header), 0) != sizeof(header) ||
+      memcmp(header.magic, code_cache_magic, sizeof(header.magic)) ||
+      header.key != key || fstat(fd, &st) < 0 ||
+      (uint64_t)st.st_size != CODE_CACHE_CODE_OFFSET + header.code_size)
+    nob_return_defer(false);
+  // mapped readable first to check the code, it only gets executable once
+  // it is known to be what was stored
+  code->exec = mmap(NULL, header.code_size, PROT_READ, MAP_PRIVATE, fd,
+                    CODE_CACHE_CODE_OFFSET);
   if (code->exec == MAP_FAILED) {
-    nob_log(NOB_ERROR, "Could not allocate executable memory: %s", str_err_no);
+    nob_log(NOB_WARNING, "could not map %s: %s", path, str_err_no);
+    code->exec = NULL;
+    nob_return_defer(false);
+  }
+  code->len = header.code_size;
+  if (code_cache_checksum(code->exec, code->len) != header.checksum) {
+    nob_log(NOB_WARNING, "%s is damaged, compiling the program again", path);
+    nob_return_defer(false);
+  }
+  if (mprotect(code->exec, code->len, PROT_EXEC) < 0) {
+    nob_log(NOB_WARNING, "could not protect %s: %s", path, str_err_no);
     nob_return_defer(false);
   }
-  memcpy(code->exec, program_as_machine_code.items,
-         program_as_machine_code.count);
-  mprotect(code->exec, program_as_machine_code.count, PROT_EXEC);
 
 defer:
-  if (!result) {
+  if (!result && code->exec) {
     free_code(*code);
-    memset(code, 0, sizeof(*code));
+    *code = (Code){0};
   }
-  nob_da_free(program_as_machine_code);
-  nob_da_free(address_stack);
-  nob_da_free(back_patches);
+  close(fd);
   return result;
 }
 
-bool machine(Program program, size_t memory_size) {
-  Code code = {0};
-  compile_to_machine_code(program, memory_size, &code);
-  if (!is_valid_code(code))
+// writes the code under key to path, through a temporary file so that no run
+// ever sees half of it
+bool code_cache_store(const char *dir, const char *path, uint64_t key,
+                      NOB_String_Builder machine_code) {
+  bool result = true;
+  if (mkdir(dir, 0755) < 0 && errno != EEXIST) {
+    nob_log(NOB_WARNING, "could not create %s: %s", dir, str_err_no);
     return false;
-  char *memory = calloc(memory_size, 1);
-  if (code.exec(memory)) {
-    nob_log(NOB_ERROR, "runtime error, check in iterpret mode");
-    NOB_FREE(memory);
-    free_code(code);
+  }
+  const char *temp_path = nob_temp_sprintf("%s.%d.tmp", path, (int)getpid());
+  int fd = open(temp_path, O_WRONLY | O_CREAT | O_EXCL, 0644);
+  if (fd < 0) {
+    nob_log(NOB_WARNING, "could not create %s: %s", temp_path, str_err_no);
     return false;
   }
-  NOB_FREE(memory);
+  Code_Cache_Header header = {
+      .key = key,
+      .code_size = machine_code.count,
+      .checksum = code_cache_checksum(machine_code.items, machine_code.count),
+  };
+  memcpy(header.magic, code_cache_magic, sizeof(header.magic));
+  if (pwrite(fd, &header, sizeof(header), 0) != sizeof(header) ||
+      pwrite(fd, machine_code.items, machine_code.count,
+             CODE_CACHE_CODE_OFFSET) != (ssize_t)machine_code.count) {
+    nob_log(NOB_WARNING, "could not write %s: %s", temp_path, str_err_no);
+    nob_return_defer(false);
+  }
+  if (close(fd) < 0 || rename(temp_path, path) < 0) {
+    fd = -1;
+    nob_log(NOB_WARNING, "could not store %s: %s", path, str_err_no);
+    nob_return_defer(false);
+  }
+  fd = -1;
+
+defer:
+  if (fd >= 0)
+    close(fd);
+  if (!result)
+    unlink(temp_path);
+  return result;
+}
+
+// runs the program with the code cached for it in cache_dir, compiling and
+// storing it there first if there is none. The source is only parsed when the
+// code has to be compiled.
+bool machine_cached(const char *file_path, NOB_String_View source,
+                    const char *cache_dir, Exec_Options options) {
+  uint64_t key = code_cache_key(source, options);
+  const char *path = nob_temp_sprintf("%s/%016llx.bin", cache_dir,
+                                      (unsigned long long)key);
+  Code code = {0};
+  stats_enter(PHASE_COMPILE);
+  if (code_cache_load(path, key, &code)) {
+    // there is no program to tell the loops apart, nor a readable copy of
+    // the code for the jitdump
+    perf_symbol("bf_main", (const char *)code.exec, NULL, code.len);
+    stats_enter(PHASE_RUN);
+    bool result = run_code(code, options, STDIN_FILENO, STDOUT_FILENO, NULL);
+    free_code(code);
+    return result;
+  }
+
+  Program program = {0};
+  stats_enter(PHASE_PARSE);
+  if (!parse_program(file_path, source, &program))
+    return false;
+  stats_enter(PHASE_COMPILE);
+  NOB_String_Builder machine_code = {0};
+  Address_Stack addresses = {0};
+  program_to_machine_code(program, options, CODE_PROGRAM, NULL,
+                          &machine_code, perf_enabled() ? &addresses : NULL);
+  // a cache that can't be written to only costs the time to compile
+  code_cache_store(cache_dir, path, key, machine_code);
+  bool result = map_machine_code(machine_code, &code);
+  if (result)
+    perf_code(program, addresses, (const char *)code.exec, machine_code);
+  nob_da_free(program);
+  nob_da_free(machine_code);
+  nob_da_free(addresses);
+  if (!result)
+    return false;
+  stats_enter(PHASE_RUN);
+  result = run_code(code, options, STDIN_FILENO, STDOUT_FILENO, NULL);
   free_code(code);
+  return result;
+}
+
+// compiles the program into a static executable at output_path
+bool compile_executable(const char *file_path, NOB_String_View source,
+                        const char *output_path, Exec_Options options) {
+  if (options.unchecked) {
+    // an executable has no signal handler to turn a fault into an error
+    nob_log(NOB_WARNING, "executables check the bounds of the tape, "
+                         "ignoring --unchecked");
+    options.unchecked = false;
+  }
+  Program program = {0};
+  if (!parse_program(file_path, source, &program))
+    return false;
+  stats_enter(PHASE_COMPILE);
+  NOB_String_Builder machine_code = {0};
+  program_to_machine_code(program, options, CODE_PROGRAM, NULL, &machine_code,
+                          NULL);
+  nob_da_free(program);
+  bool result = write_executable(output_path, machine_code, options);
+  nob_da_free(machine_code);
+  return result;
+}
+
+// a line of a batch manifest, the program to run, the file it reads its input
+// from and the file its output goes to
+typedef struct {
+  const char *program_path;
+  const char *input_path;
+  const char *output_path;
+  size_t line;
+  size_t program; // index in Batch.programs
+} Batch_Job;
+
+typedef struct {
+  Batch_Job *items;
+  size_t count;
+  size_t capacity;
+} Batch_Jobs;
+
+// compiled once and shared by every job of the same program, the compiled
+// code keeps its state in registers and on the tape so any number of threads
+// can run it at once
+typedef struct {
+  const char *path;
+  Code code; // invalid when the program could not be compiled
+} Batch_Program;
+
+typedef struct {
+  Batch_Program *items;
+  size_t count;
+  size_t capacity;
+} Batch_Programs;
+
+typedef struct {
+  const char *manifest_path;
+  Exec_Options options;
+  NOB_String_Builder manifest; // the paths point into it
+  Batch_Jobs jobs;
+  Batch_Programs programs;
+  Instance_Pool instances; // shared by all programs, their options are the same
+  atomic_size_t failed;
+} Batch;
+
+// the next field of a manifest line split at whitespace, cut off in place
+char *batch_field(char **line) {
+  char *field = *line + strspn(*line, " \t\r");
+  if (!*field)
+    return NULL;
+  char *end = field + strcspn(field, " \t\r");
+  *line = *end ? end + 1 : end;
+  *end = '\0';
+  return field;
+}
+
+// a manifest has a job per line, `<program> <input> <output>` with `-` as the
+// input of a program that reads none. Empty lines and lines starting with #
+// are skipped.
+bool batch_load(Batch *batch) {
+  if (!nob_read_entire_file(batch->manifest_path, &batch->manifest))
+    return false;
+  nob_sb_append_null(&batch->manifest);
+  char *next = batch->manifest.items;
+  for (size_t line = 1; next; line++) {
+    char *text = next;
+    next = strchr(text, '\n');
+    if (next)
+      *next++ = '\0';
+    char *program_path = batch_field(&text);
+    if (!program_path || *program_path == '#')
+      continue;
+    char *input_path = batch_field(&text);
+    char *output_path = batch_field(&text);
+    if (!output_path || batch_field(&text)) {
+      nob_log(NOB_ERROR, "%s:%zu: expected <program> <input> <output>",
+              batch->manifest_path, line);
+      return false;
+    }
+    Batch_Job job = {
+        .program_path = program_path,
+        // a program without input sees the end of it right away
+        .input_path = strcmp(input_path, "-") ? input_path : "/dev/null",
+        .output_path = output_path,
+        .line = line,
+    };
+    // jobs tend to come in runs of the same program
+    size_t i = batch->programs.count;
+    while (i > 0 && strcmp(batch->programs.items[i - 1].path, program_path))
+      i--;
+    if (i == 0) {
+      Batch_Program program = {.path = program_path};
+      nob_da_append(&batch->programs, program);
+      i = batch->programs.count;
+    }
+    job.program = i - 1;
+    nob_da_append(&batch->jobs, job);
+  }
   return true;
 }
 
-bool string_to_program(const char *file_path, Program *program) {
-  NOB_String_Builder program_as_string = {0};
+void batch_compile(void *context, size_t index) {
+  Batch *batch = context;
+  Batch_Program *program = batch->programs.items + index;
+  Source source;
+  if (!source_open(program->path, &source)) {
+    nob_log(NOB_ERROR, "could not read %s: %s", program->path, str_err_no);
+    return;
+  }
+  Program parsed = {0};
+  if (parse_program(program->path, source.text, &parsed))
+    compile_to_machine_code(parsed, batch->options, CODE_PROGRAM,
+                            &program->code);
+  source_close(source);
+  nob_da_free(parsed);
+}
+
+void batch_run(void *context, size_t index) {
+  Batch *batch = context;
+  Batch_Job *job = batch->jobs.items + index;
+  Code code = batch->programs.items[job->program].code;
+  bool ok = is_valid_code(code);
+  int in_fd = -1, out_fd = -1;
+  if (ok) {
+    in_fd = open(job->input_path, O_RDONLY);
+    if (in_fd < 0) {
+      nob_log(NOB_ERROR, "could not open %s: %s", job->input_path,
+              str_err_no);
+      ok = false;
+    }
+  }
+  if (ok) {
+    out_fd = open(job->output_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (out_fd < 0) {
+      nob_log(NOB_ERROR, "could not open %s: %s", job->output_path,
+              str_err_no);
+      ok = false;
+    }
+  }
+  if (ok) {
+    Instance *instance = instance_acquire(&batch->instances);
+    ok = instance != NULL;
+    if (ok) {
+      ok = run_instance(code, instance, in_fd, out_fd, NULL);
+      // the programs keep no water marks, mostly they run long enough for
+      // zeroing the whole tape not to matter
+      instance_release(&batch->instances, instance, 0, instance->tape.size);
+    }
+  }
+  if (in_fd >= 0)
+    close(in_fd);
+  if (out_fd >= 0 && close(out_fd) < 0)
+    ok = false;
+  if (!ok) {
+    nob_log(NOB_ERROR, "%s:%zu: %s failed", batch->manifest_path, job->line,
+            job->program_path);
+    atomic_fetch_add(&batch->failed, 1);
+  }
+}
+
+// runs every job of the manifest on threads threads. Every program gets
+// compiled once up front, then the threads take the next job that is left
+// whenever they are done with one, so a few long jobs don't hold up the rest.
+// A job that fails doesn't stop the others.
+bool run_batch(const char *manifest_path, Exec_Options options,
+               size_t threads) {
+  Batch batch = {
+      .manifest_path = manifest_path,
+      .options = options,
+  };
   bool result = true;
-  if (!nob_read_entire_file(file_path, &program_as_string)) {
-    nob_log(NOB_ERROR, "something went wrong while reading %s", file_path);
+  instance_pool_init(&batch.instances, options);
+  stats_enter(PHASE_PARSE);
+  if (!batch_load(&batch))
+    nob_return_defer(false);
+  stats_enter(PHASE_COMPILE);
+  parallel_for_threads(threads, batch.programs.count, batch_compile, &batch);
+  stats_enter(PHASE_RUN);
+  parallel_for_threads(threads, batch.jobs.count, batch_run, &batch);
+  size_t failed = atomic_load(&batch.failed);
+  if (failed) {
+    nob_log(NOB_ERROR, "%zu of %zu jobs failed", failed, batch.jobs.count);
     nob_return_defer(false);
   }
-  Lexer l = {
-      .content =
-          {
-              .count = program_as_string.count,
-              .data = program_as_string.items,
-          },
-      .pos = 0,
-  };
-  Address_Stack address_stack = {0};
-  char token = lexer_next(&l, is_bf_token);
-  while (token) {
-    switch (token) {
-    case OP_INC:
-    case OP_DEC:
-    case OP_RIGHT:
-    case OP_LEFT:
-    case OP_OUTPUT:
-    case OP_INPUT: {
-      size_t count = 1;
-      char operator_tmp = lexer_next(&l, is_bf_token);
-      while (operator_tmp == token) {
-        count++;
-        operator_tmp = lexer_next(&l, is_bf_token);
-      }
-      Operator op = {
-          .op_kind = token,
-          .operand = count,
-      };
-      nob_da_append(program, op);
-      token = operator_tmp;
-    } break;
-    case OP_JMP_IF_ZERO: {
-      size_t address = program->count;
-      Operator op = {
-          .op_kind = token,
-          .operand = 0,
-      };
 
-      nob_da_append(program, op);
-      nob_da_append(&address_stack, address);
+defer:
+  for (size_t i = 0; i < batch.programs.count; i++)
+    if (is_valid_code(batch.programs.items[i].code))
+      free_code(batch.programs.items[i].code);
+  instance_pool_free(&batch.instances);
+  nob_da_free(batch.programs);
+  nob_da_free(batch.jobs);
+  nob_sb_free(batch.manifest);
+  return result;
+}
 
-      token = lexer_next(&l, is_bf_token);
-    } break;
-    case OP_JMP_IF_NON_ZERO: {
-      if (!address_stack.count) {
-        nob_log(NOB_ERROR, "%s [%zu]: Unbalanced jump", file_path, l.pos);
-        nob_return_defer(false);
-      }
+// times the interpreter goes back to the start of a loop before the loop gets
+// compiled
+#define TIER_THRESHOLD 4096
 
-      size_t address = address_stack.items[--address_stack.count];
+typedef struct {
+  size_t back_edges; // counted by the interpreter
+  bool queued;       // handed to the compiler thread by the interpreter
+  Code code;         // set by the compiler thread before ready
+  atomic_bool ready;
+} Tier_Loop;
 
-      Operator op = {
-          .op_kind = token,
-          .operand = address + 1,
-      };
+struct Tiers {
+  Program program;
+  Exec_Options options;
+  Tier_Loop *loops; // indexed by the '[' of the loop
+  pthread_t compiler;
+  pthread_mutex_t lock;
+  pthread_cond_t wake;
+  Address_Stack queue; // '[' of the loops waiting to be compiled
+  bool done;
+};
 
-      nob_da_append(program, op);
-      program->items[address].operand = program->count;
+// compiles the loop whose '[' is at start on its own
+bool compile_loop(Program program, size_t start, Exec_Options options,
+                  Code *code) {
+  Program loop = {0};
+  size_t count = program.items[start].operand - start;
+  nob_da_append_many(&loop, program.items + start, count);
+  link_jumps(&loop);
+  if (options.profile)
+    options.profile += start;
+  bool result = compile_to_machine_code(loop, options, CODE_FRAGMENT, code);
+  nob_da_free(loop);
+  return result;
+}
+
+void *tier_compiler(void *arg) {
+  Tiers *tiers = arg;
+  pthread_mutex_lock(&tiers->lock);
+  for (;;) {
+    while (!tiers->queue.count && !tiers->done)
+      pthread_cond_wait(&tiers->wake, &tiers->lock);
+    if (tiers->done)
+      break;
+    // the loop that got hot last is likely the one running right now
+    size_t start = tiers->queue.items[--tiers->queue.count];
+    pthread_mutex_unlock(&tiers->lock);
+    Tier_Loop *loop = tiers->loops + start;
+    if (compile_loop(tiers->program, start, tiers->options, &loop->code))
+      atomic_store_explicit(&loop->ready, true, memory_order_release);
+    pthread_mutex_lock(&tiers->lock);
+  }
+  pthread_mutex_unlock(&tiers->lock);
+  return NULL;
+}
 
-      token = lexer_next(&l, is_bf_token);
+bool tiers_begin(Tiers *tiers, Program program, Exec_Options options) {
+  memset(tiers, 0, sizeof(*tiers));
+  tiers->program = program;
+  tiers->options = options;
+  tiers->loops = calloc(program.count, sizeof(*tiers->loops));
+  NOB_ASSERT(tiers->loops != NULL && "Buy More RAM LOL");
+  pthread_mutex_init(&tiers->lock, NULL);
+  pthread_cond_init(&tiers->wake, NULL);
+  int error = pthread_create(&tiers->compiler, NULL, tier_compiler, tiers);
+  if (error) {
+    nob_log(NOB_ERROR, "could not start the compiler thread: %s",
+            strerror(error));
+    pthread_mutex_destroy(&tiers->lock);
+    pthread_cond_destroy(&tiers->wake);
+    NOB_FREE(tiers->loops);
+    return false;
+  }
+  return true;
+}
 
-    } break;
+void tiers_end(Tiers *tiers) {
+  pthread_mutex_lock(&tiers->lock);
+  tiers->done = true;
+  pthread_cond_signal(&tiers->wake);
+  pthread_mutex_unlock(&tiers->lock);
+  pthread_join(tiers->compiler, NULL);
+  for (size_t i = 0; i < tiers->program.count; i++) {
+    if (atomic_load(&tiers->loops[i].ready))
+      free_code(tiers->loops[i].code);
+  }
+  pthread_mutex_destroy(&tiers->lock);
+  pthread_cond_destroy(&tiers->wake);
+  NOB_FREE(tiers->loops);
+  nob_da_free(tiers->queue);
+}
+
+// runs the loop whose '[' is at start on the tape at memory as machine code
+// once the compiler is done with it, a back edge counts towards getting it
+// compiled. Returns false while the loop still has to be interpreted,
+// otherwise status tells how the code went and head is where it left the
+// pointer.
+bool tier_run(Tiers *tiers, size_t start, bool back_edge, char *memory,
+              size_t *head, Runtime *rt, Exec_Status *status) {
+  Tier_Loop *loop = tiers->loops + start;
+  if (!atomic_load_explicit(&loop->ready, memory_order_acquire)) {
+    if (back_edge && !loop->queued && ++loop->back_edges >= TIER_THRESHOLD) {
+      loop->queued = true;
+      pthread_mutex_lock(&tiers->lock);
+      nob_da_append(&tiers->queue, start);
+      pthread_cond_signal(&tiers->wake);
+      pthread_mutex_unlock(&tiers->lock);
+    }
+    return false;
+  }
+  rt->head = *head;
+  *status =
+      loop->code.exec(memory + *head * tiers->options.cell_size, rt);
+  *head = rt->head;
+  return true;
+}
+
+// loops --profile prints, the ones whose bodies ran most often
+#define PROFILE_TOP_LOOPS 10
+
+typedef struct {
+  size_t start;  // index of the '['
+  uint64_t runs; // of the body
+} Loop_Runs;
+
+int compare_loop_runs(const void *a, const void *b) {
+  uint64_t x = ((const Loop_Runs *)a)->runs;
+  uint64_t y = ((const Loop_Runs *)b)->runs;
+  return x < y ? 1 : x > y ? -1 : 0;
+}
+
+// prints the loops whose bodies ran most often to stderr with where they
+// start in the source. Loops the optimizer turned into something else are not
+// loops anymore and don't show up.
+void profile_report(Program program, const uint64_t *profile) {
+  struct {
+    Loop_Runs *items;
+    size_t count;
+    size_t capacity;
+  } loops = {0};
+  uint64_t total = 0;
+  for (size_t i = 0; i < program.count; i++) {
+    if (program.items[i].op_kind != OP_JMP_IF_ZERO)
+      continue;
+    Loop_Runs loop = {.start = i, .runs = profile[i]};
+    nob_da_append(&loops, loop);
+    total += profile[i];
+  }
+  qsort(loops.items, loops.count, sizeof(*loops.items), compare_loop_runs);
+
+  fprintf(stderr, "profile: %zu loops, their bodies ran %llu times\n",
+          loops.count, (unsigned long long)total);
+  for (size_t i = 0; i < loops.count && i < PROFILE_TOP_LOOPS; i++) {
+    Loop_Runs loop = loops.items[i];
+    if (!loop.runs)
+      break;
+    fprintf(stderr, "  %20llu runs %6.2f%%  '[' at offset %td\n",
+            (unsigned long long)loop.runs, 100.0 * loop.runs / total,
+            program.items[loop.start].source);
+  }
+  nob_da_free(loops);
+}
+
+struct Bfjit {
+  Code code;
+  Instance_Pool instances; // one for every run at the same time so far
+  // farthest the operators address cells left and right of the pointer, the
+  // cells a run wrote to lie within that of its water marks
+  size_t reach_left;
+  size_t reach_right;
+};
+
+Bfjit *bfjit_compile(const char *source, size_t size,
+                     const Bfjit_Options *options) {
+  Exec_Options exec = exec_options_default();
+  bool bidirectional = false;
+  if (options) {
+    if (options->tape_size)
+      exec.memory_size = options->tape_size;
+    switch (options->cell_bits) {
+    case 0:
+    case 8:
+      exec.cell_size = 1;
+      break;
+    case 16:
+      exec.cell_size = 2;
+      break;
+    case 32:
+      exec.cell_size = 4;
+      break;
+    case 64:
+      exec.cell_size = 8;
+      break;
     default:
-      NOB_ASSERT(0 && "Unreachable");
+      nob_log(NOB_ERROR, "cell_bits takes 8, 16, 32 or 64, not %u",
+              options->cell_bits);
+      return NULL;
     }
+    if ((unsigned)options->eof > BFJIT_EOF_MINUS_ONE) {
+      nob_log(NOB_ERROR, "unknown eof %d", options->eof);
+      return NULL;
+    }
+    exec.eof_mode = (Eof_Mode)options->eof;
+    exec.unchecked = options->unchecked;
+    bidirectional = options->bidirectional;
   }
+  exec_options_settle(&exec, bidirectional);
+  exec.water_marks = true;
 
-  if (address_stack.count) {
-    nob_log(NOB_ERROR, "%s: Unbalanced jump", file_path);
-    nob_return_defer(false);
+  Program program = {0};
+  if (!parse_program("<source>", nob_sv_from_parts(source, size), &program))
+    return NULL;
+  Code code = {0};
+  bool compiled = compile_to_machine_code(program, exec, CODE_PROGRAM, &code);
+  size_t reach_left = 0, reach_right = 0;
+  for (size_t i = 0; compiled && i < program.count; i++) {
+    const Operator *op = program.items + i;
+    if (op->op_kind == OP_CHECK || op->op_kind == OP_JMP_IF_ZERO)
+      continue;
+    ptrdiff_t offsets[2] = {op->offset,
+                            op->op_kind == OP_MUL ? op->source : 0};
+    for (size_t j = 0; j < NOB_ARRAY_LEN(offsets); j++) {
+      if (offsets[j] < 0 && (size_t)-offsets[j] > reach_left)
+        reach_left = -offsets[j];
+      if (offsets[j] > 0 && (size_t)offsets[j] > reach_right)
+        reach_right = offsets[j];
+    }
+  }
+  nob_da_free(program);
+  if (!compiled)
+    return NULL;
+  Bfjit *bf = malloc(sizeof(*bf));
+  if (bf == NULL) {
+    nob_log(NOB_ERROR, "could not allocate the program: %s", str_err_no);
+    free_code(code);
+    return NULL;
   }
+  bf->code = code;
+  instance_pool_init(&bf->instances, exec);
+  bf->reach_left = reach_left;
+  bf->reach_right = reach_right;
+  return bf;
+}
 
-defer:
-  if (!result) {
-    nob_da_free(*program);
-    memset(program, 0, sizeof(*program));
+bool bfjit_warm(Bfjit *bf, size_t runs) {
+  Instance *taken = NULL;
+  bool result = true;
+  // taken all at once so the pool has to make the ones it is missing
+  for (size_t i = 0; i < runs; i++) {
+    Instance *instance = instance_acquire(&bf->instances);
+    if (!instance) {
+      result = false;
+      break;
+    }
+    instance->next = taken;
+    taken = instance;
   }
+  while (taken) {
+    Instance *next = taken->next;
+    instance_release(&bf->instances, taken, 0, 0);
+    taken = next;
+  }
+  return result;
+}
+
+bool bfjit_run(Bfjit *bf, const Bfjit_Io *io) {
+  static const Bfjit_Io no_io = {0};
+  if (!io)
+    io = &no_io;
+  Instance *instance = instance_acquire(&bf->instances);
+  if (!instance)
+    return false;
+  bool result = run_instance(bf->code, instance, -1, -1, io);
+  // water marks of moves off an unchecked tape are cut down to it
+  const Runtime *rt = &instance->rt;
+  size_t size = instance->tape.size;
+  size_t low = rt->low_water < size && rt->low_water > bf->reach_left
+                   ? rt->low_water - bf->reach_left
+                   : 0;
+  size_t high =
+      rt->high_water < size ? rt->high_water + bf->reach_right + 1 : size;
+  instance_release(&bf->instances, instance, low, high);
   return result;
 }
 
+// input and output of bfjit_run_memory
 typedef struct {
-  const char *file_path;
-  enum { MACHINE, INTERPRET } mode;
-} Options;
+  const char *input;
+  size_t input_size;
+  size_t input_pos;
+  Bfjit_Buffer *output;
+} Memory_Io;
+
+size_t memory_io_read(void *context, char *items, size_t capacity) {
+  Memory_Io *mio = context;
+  size_t n = mio->input_size - mio->input_pos;
+  if (n > capacity)
+    n = capacity;
+  memcpy(items, mio->input + mio->input_pos, n);
+  mio->input_pos += n;
+  return n;
+}
+
+// grows the output by hand, running out of memory fails the run instead of
+// aborting the process like nob_da_append_many does
+bool memory_io_write(void *context, const char *items, size_t count) {
+  Bfjit_Buffer *output = ((Memory_Io *)context)->output;
+  if (output->count + count > output->capacity) {
+    size_t capacity = output->capacity ? output->capacity : NOB_DA_INIT_CAP;
+    while (output->count + count > capacity)
+      capacity *= 2;
+    char *grown = realloc(output->items, capacity);
+    if (grown == NULL)
+      return false;
+    output->items = grown;
+    output->capacity = capacity;
+  }
+  memcpy(output->items + output->count, items, count);
+  output->count += count;
+  return true;
+}
+
+bool bfjit_run_memory(Bfjit *bf, const char *input, size_t input_size,
+                      Bfjit_Buffer *output) {
+  Memory_Io mio = {
+      .input = input,
+      .input_size = input_size,
+      .output = output,
+  };
+  Bfjit_Io io = {
+      .read = memory_io_read,
+      .write = memory_io_write,
+      .context = &mio,
+  };
+  return bfjit_run(bf, &io);
+}
+
+void bfjit_free(Bfjit *bf) {
+  if (!bf)
+    return;
+  free_code(bf->code);
+  instance_pool_free(&bf->instances);
+  free(bf);
+}
 
+#ifndef BFJIT_LIBRARY
 void usage(const char *binary) {
   nob_log(NOB_ERROR, "Usage: %s [OPTIONS] <input>", binary);
-  nob_log(NOB_ERROR, "Options\n\t\033]2m-mi\033]0m\t\t interpreter mode");
+  nob_log(NOB_ERROR, "Options\n\t\033]2m-mi\033]0m\t\t interpreter mode"
+                     "\n\t\033]2m-mt\033]0m\t\t threaded interpreter mode"
+                     "\n\t\033]2m-ma\033]0m\t\t tiered mode, interprets and "
+                     "compiles hot loops in the background"
+                     "\n\t\033]2m--eof <leave|0|-1>\033]0m\t what ',' stores "
+                     "once the input has run out (default leave)"
+                     "\n\t\033]2m--unchecked\033]0m\t\t leave the bounds "
+                     "checks to guard pages around the tape"
+                     "\n\t\033]2m--no-cache\033]0m\t\t keep every byte "
+                     "on the tape instead of caching some in registers"
+                     "\n\t\033]2m--lazy\033]0m\t\t compile loops when they "
+                     "are first reached"
+                     "\n\t\033]2m--cache <dir>\033]0m\t keep the "
+                     "compiled code in dir and reuse it on later runs"
+                     "\n\t\033]2m-o <file>\033]0m\t write a static "
+                     "executable of the program to file instead of running "
+                     "it"
+                     "\n\t\033]2m--stats\033]0m\t\t print the time spent "
+                     "parsing, compiling and running to stderr"
+                     "\n\t\033]2m--profile\033]0m\t\t count how often "
+                     "every loop goes around and print the busiest ones"
+                     "\n\t\033]2m--perf-map\033]0m\t\t name the compiled "
+                     "loops for perf in /tmp/perf-<pid>.map"
+                     "\n\t\033]2m--jitdump\033]0m\t\t write the compiled "
+                     "loops to /tmp/jit-<pid>.dump for perf inject --jit"
+                     "\n\t\033]2m--tape-size <n>\033]0m\t cells on the "
+                     "tape, with an optional k, m or g suffix (default 64m)"
+                     "\n\t\033]2m--cell-bits <n>\033]0m\t bits in a cell, "
+                     "8, 16, 32 or 64 (default 8)"
+                     "\n\t\033]2m--bidirectional\033]0m\t start in the "
+                     "middle of the tape so '<' can go left of the start"
+                     "\n\t\033]2m--batch <file>\033]0m\t run the jobs "
+                     "listed in file, a `<program> <input|-> <output>` per "
+                     "line"
+                     "\n\t\033]2m-j <n>\033]0m\t\t run a batch on n "
+                     "threads (default one per core)");
+}
+
+// reads a size like 4096, 64k, 16m or 1g, in powers of 1024
+bool parse_size(const char *text, size_t *size) {
+  char *end = NULL;
+  errno = 0;
+  unsigned long long value = strtoull(text, &end, 10);
+  if (end == text || errno)
+    return false;
+  int shift = 0;
+  switch (*end) {
+  case 'k':
+  case 'K':
+    shift = 10;
+    end++;
+    break;
+  case 'm':
+  case 'M':
+    shift = 20;
+    end++;
+    break;
+  case 'g':
+  case 'G':
+    shift = 30;
+    end++;
+    break;
+  }
+  if (*end || value == 0 || value > (SIZE_MAX >> shift))
+    return false;
+  *size = (size_t)value << shift;
+  return true;
 }
 
 bool handle_args(int *argc, char ***argv, Options *options) {
   const char *binary = nob_shift_args(argc, argv);
 
-  if (*argc > 2 || *argc < 1) {
+  if (*argc < 1) {
     usage(binary);
     return false;
   }
@@ -430,6 +5080,89 @@ bool handle_args(int *argc, char ***argv, Options *options) {
     const char *arg = nob_shift_args(argc, argv);
     if (!strcmp(arg, "-mi")) {
       options->mode = INTERPRET;
+      options->exec.threaded = false;
+    } else if (!strcmp(arg, "-mt")) {
+      options->mode = INTERPRET;
+      options->exec.threaded = true;
+    } else if (!strcmp(arg, "-ma")) {
+      options->mode = TIERED;
+      options->exec.threaded = false;
+    } else if (!strcmp(arg, "--eof")) {
+      const char *value = *argc ? nob_shift_args(argc, argv) : "";
+      if (!strcmp(value, "leave")) {
+        options->exec.eof_mode = EOF_LEAVE;
+      } else if (!strcmp(value, "0")) {
+        options->exec.eof_mode = EOF_ZERO;
+      } else if (!strcmp(value, "-1")) {
+        options->exec.eof_mode = EOF_MINUS_ONE;
+      } else {
+        usage(binary);
+        return false;
+      }
+    } else if (!strcmp(arg, "--unchecked")) {
+      options->exec.unchecked = true;
+    } else if (!strcmp(arg, "--no-cache")) {
+      options->exec.cache_cells = false;
+    } else if (!strcmp(arg, "--lazy")) {
+      options->exec.lazy = true;
+    } else if (!strcmp(arg, "--cache")) {
+      if (!*argc) {
+        usage(binary);
+        return false;
+      }
+      options->cache_dir = nob_shift_args(argc, argv);
+    } else if (!strcmp(arg, "-o")) {
+      if (!*argc) {
+        usage(binary);
+        return false;
+      }
+      options->output_path = nob_shift_args(argc, argv);
+    } else if (!strcmp(arg, "--stats")) {
+      options->stats = true;
+    } else if (!strcmp(arg, "--profile")) {
+      options->profile = true;
+    } else if (!strcmp(arg, "--perf-map")) {
+      options->perf_map = true;
+    } else if (!strcmp(arg, "--jitdump")) {
+      options->jitdump = true;
+    } else if (!strcmp(arg, "--tape-size")) {
+      const char *value = *argc ? nob_shift_args(argc, argv) : "";
+      if (!parse_size(value, &options->exec.memory_size)) {
+        nob_log(NOB_ERROR, "--tape-size takes a size like 30000 or 64m");
+        return false;
+      }
+    } else if (!strcmp(arg, "--cell-bits")) {
+      const char *value = *argc ? nob_shift_args(argc, argv) : "";
+      if (!strcmp(value, "8")) {
+        options->exec.cell_size = 1;
+      } else if (!strcmp(value, "16")) {
+        options->exec.cell_size = 2;
+      } else if (!strcmp(value, "32")) {
+        options->exec.cell_size = 4;
+      } else if (!strcmp(value, "64")) {
+        options->exec.cell_size = 8;
+      } else {
+        nob_log(NOB_ERROR, "--cell-bits takes 8, 16, 32 or 64");
+        return false;
+      }
+    } else if (!strcmp(arg, "--bidirectional")) {
+      options->bidirectional = true;
+    } else if (!strcmp(arg, "--batch")) {
+      if (!*argc) {
+        usage(binary);
+        return false;
+      }
+      options->batch_path = nob_shift_args(argc, argv);
+    } else if (!strcmp(arg, "-j")) {
+      char *end = NULL;
+      const char *value = *argc ? nob_shift_args(argc, argv) : "";
+      unsigned long threads = strtoul(value, &end, 10);
+      if (!*value || *end || threads == 0 || threads > PARALLEL_MAX_THREADS) {
+        nob_log(NOB_ERROR, "-j takes a number of threads from 1 to %d",
+                PARALLEL_MAX_THREADS);
+        return false;
+      }
+      options->threads = threads;
     } else {
       if (nob_file_exists(arg)) {
         options->file_path = arg;
@@ -440,40 +5173,102 @@ bool handle_args(int *argc, char ***argv, Options *options) {
     }
   }
 
-  return options->file_path != NULL;
+  return options->file_path != NULL || options->batch_path != NULL;
 }
 
 int main(int argc, char **argv) {
+  clock_gettime(CLOCK_MONOTONIC, &stats.entered);
 
   Options options = {0};
+  options.exec = exec_options_default();
   if (!handle_args(&argc, &argv, &options)) {
     return EXIT_FAILURE;
   }
+  if (options.stats)
+    atexit(stats_print);
+  exec_options_settle(&options.exec, options.bidirectional);
+  if (options.batch_path) {
+    // every job runs compiled code that is shared and stays as it is
+    if (options.mode != MACHINE || options.exec.lazy || options.profile ||
+        options.cache_dir || options.output_path || options.file_path)
+      nob_log(NOB_WARNING, "--batch compiles every program up front and "
+                           "runs the jobs in the manifest only, ignoring "
+                           "-mi, -mt, -ma, --lazy, --profile, --cache, -o "
+                           "and <input>");
+    options.exec.lazy = false;
+    perf_begin(options.perf_map, options.jitdump);
+    size_t threads = options.threads ? options.threads : parallel_threads();
+    return run_batch(options.batch_path, options.exec, threads)
+               ? EXIT_SUCCESS
+               : EXIT_FAILURE;
+  }
+  Source source;
+  if (!source_open(options.file_path, &source)) {
+    nob_log(NOB_ERROR, "something went wrong while reading %s: %s",
+            options.file_path, str_err_no);
+    return EXIT_FAILURE;
+  }
+  NOB_String_View source_view = source.text;
+  if (options.output_path && options.profile) {
+    // nothing would be left to print the counts once the executable is done
+    nob_log(NOB_WARNING, "executables can't be profiled, ignoring --profile");
+    options.profile = false;
+  }
+  if (!options.output_path)
+    perf_begin(options.perf_map, options.jitdump);
+  if (options.output_path) {
+    bool ok = compile_executable(options.file_path, source_view,
+                                 options.output_path, options.exec);
+    source_close(source);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+  if (options.mode == MACHINE && options.cache_dir) {
+    // lazily compiled and profiled code points into this process, there is
+    // nothing to keep
+    if (options.exec.lazy || options.profile) {
+      nob_log(NOB_WARNING, "--cache does not work with %s, ignoring it",
+              options.exec.lazy ? "--lazy" : "--profile");
+    } else {
+      bool ok = machine_cached(options.file_path, source_view,
+                               options.cache_dir, options.exec);
+      source_close(source);
+      return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+  }
 
-  size_t memory_size = 8 * 1024 * 1024 * 8;
   Program program = {0};
-
-  if (!string_to_program(options.file_path, &program)) {
-    nob_da_free(program);
+  bool parsed = parse_program(options.file_path, source_view, &program);
+  source_close(source);
+  if (!parsed)
     return EXIT_FAILURE;
+  if (options.profile) {
+    options.exec.profile = calloc(program.count, sizeof(uint64_t));
+    NOB_ASSERT(options.exec.profile != NULL && "Buy More RAM LOL");
   }
+  bool ok = false;
   switch (options.mode) {
   case MACHINE: {
-    if (!machine(program, memory_size)) {
-      nob_da_free(program);
-      return EXIT_FAILURE;
-    }
+    ok = machine(program, options.exec);
   } break;
   case INTERPRET: {
-    if (!interpret(program, memory_size)) {
-      nob_da_free(program);
-      return EXIT_FAILURE;
-    }
+    ok = interpret(program, options.exec, NULL);
+  } break;
+  case TIERED: {
+    Tiers tiers;
+    if (!tiers_begin(&tiers, program, options.exec))
+      break;
+    ok = interpret(program, options.exec, &tiers);
+    tiers_end(&tiers);
   } break;
   default:
     NOB_ASSERT(0 && "Unreachable");
-    nob_da_free(program);
-    return EXIT_FAILURE;
   }
-  return EXIT_SUCCESS;
+  if (options.profile) {
+    // a run that failed still shows where it spent its time
+    profile_report(program, options.exec.profile);
+    NOB_FREE(options.exec.profile);
+  }
+  nob_da_free(program);
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
 }
+#endif // BFJIT_LIBRARY
@@ -0,0 +1,71 @@
+// bf-jit as a library: compile a program once and run it as often as needed,
+// each run on a fresh tape with its input and output going through the
+// callbacks of the caller instead of stdin and stdout. Build it with
+// `nob lib` into build/libbf-jit.so, which exports nothing but what is declared
+// here. Errors are logged to stderr.
+#ifndef BF_JIT_H_
+#define BF_JIT_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#define BFJIT_API __attribute__((visibility("default")))
+
+// what ',' stores in the current cell once the input has run out
+typedef enum {
+  BFJIT_EOF_LEAVE = 0, // keep the current cell as it is
+  BFJIT_EOF_ZERO = 1,
+  BFJIT_EOF_MINUS_ONE = 2,
+} Bfjit_Eof;
+
+// a zeroed struct asks for the defaults of the command line
+typedef struct {
+  size_t tape_size;      // cells on the tape, 0 for 64 Mi
+  unsigned cell_bits;    // 8, 16, 32 or 64, 0 for 8
+  Bfjit_Eof eof;         // what ',' does at the end of the input
+  bool bidirectional;    // start in the middle of the tape
+  bool unchecked;        // leave the bounds checks to guard pages
+} Bfjit_Options;
+
+typedef struct {
+  // puts up to capacity bytes of input into items and returns how many, 0
+  // once the input has run out. NULL reads no input at all.
+  size_t (*read)(void *context, char *items, size_t capacity);
+  // takes count bytes of output, returns false if it could not which stops
+  // the program with an error. NULL drops the output.
+  bool (*write)(void *context, const char *items, size_t count);
+  void *context;
+} Bfjit_Io;
+
+// output of bfjit_run_memory, free items with free() when done
+typedef struct {
+  char *items;
+  size_t count;
+  size_t capacity;
+} Bfjit_Buffer;
+
+// a compiled program
+typedef struct Bfjit Bfjit;
+
+// compiles the size bytes of source, options may be NULL. Returns NULL when
+// the program does not parse or can't be compiled.
+BFJIT_API Bfjit *bfjit_compile(const char *source, size_t size,
+                               const Bfjit_Options *options);
+
+// runs the program on a zeroed tape, returns whether it ran to its end. A NULL
+// io is the same as one with neither callback. Runs of the same program may
+// happen on several threads at once. The tapes are kept for the next runs,
+// only the part a run touched gets zeroed after it.
+BFJIT_API bool bfjit_run(Bfjit *bf, const Bfjit_Io *io);
+
+// runs the program on input and appends what it prints to output
+BFJIT_API bool bfjit_run_memory(Bfjit *bf, const char *input,
+                                size_t input_size, Bfjit_Buffer *output);
+
+// sets up the tapes for that many runs at the same time up front, which the
+// first runs would otherwise do themselves
+BFJIT_API bool bfjit_warm(Bfjit *bf, size_t runs);
+
+BFJIT_API void bfjit_free(Bfjit *bf);
+
+#endif // BF_JIT_H_
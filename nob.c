@@ -1,19 +1,294 @@
+#include <fcntl.h>
 #include <stdlib.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
 
 #define NOB_IMPL
 #include "nob.h"
 
 void cc(NOB_Cmd *cmd) {
   nob_cmd_append(cmd, "cc");
-  nob_cmd_append(cmd, "-Wall", "-Wextra", "-ggdb");
+  nob_cmd_append(cmd, "-Wall", "-Wextra", "-ggdb", "-pthread");
   nob_cmd_append(cmd, "-O3");
 }
 
+// programs in bench/, each comes with the output it has to produce in
+// <name>.out and may read <name>.in
+static const char *benchmarks[] = {
+    "mandelbrot", "hanoi", "loops", "dbfi", "rot13",
+};
+
+static const struct {
+  const char *name;
+  const char *flag; // NULL for the default mode
+} bench_modes[] = {
+    {"interpret", "-mi"},
+    {"threaded", "-mt"},
+    {"jit", NULL},
+};
+
+#define BENCH_DEFAULT_RUNS 3
+
+typedef struct {
+  double parse_ms, compile_ms, run_ms, wall_ms; // fastest of the runs
+  long max_rss_kb;                              // most of the runs
+  bool ok;                                      // every run had the output
+} Bench_Result;
+
+double now_ms(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec * 1e3 + now.tv_nsec / 1e6;
+}
+
+// runs binary on bf_path once with in_path on stdin, stdout and stderr go to
+// out_path and err_path
+bool bench_spawn(const char *binary, const char *flag, const char *bf_path,
+                 const char *in_path, const char *out_path,
+                 const char *err_path, double *wall_ms, long *max_rss_kb) {
+  const char *argv[] = {binary, "--stats", bf_path, NULL, NULL};
+  if (flag) {
+    argv[2] = flag;
+    argv[3] = bf_path;
+  }
+
+  double start = now_ms();
+  pid_t pid = fork();
+  if (pid < 0) {
+    nob_log(NOB_ERROR, "could not fork: %s", strerror(errno));
+    return false;
+  }
+  if (pid == 0) {
+    int in = open(in_path, O_RDONLY);
+    int out = open(out_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    int err = open(err_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (in < 0 || out < 0 || err < 0 || dup2(in, STDIN_FILENO) < 0 ||
+        dup2(out, STDOUT_FILENO) < 0 || dup2(err, STDERR_FILENO) < 0)
+      _exit(127);
+    execv(binary, (char *const *)argv);
+    _exit(127);
+  }
+  int status;
+  struct rusage usage;
+  if (wait4(pid, &status, 0, &usage) < 0) {
+    nob_log(NOB_ERROR, "could not wait for %s: %s", binary, strerror(errno));
+    return false;
+  }
+  *wall_ms = now_ms() - start;
+  *max_rss_kb = usage.ru_maxrss;
+  if (!WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS) {
+    nob_log(NOB_ERROR, "%s %s on %s failed, see %s", binary, flag ? flag : "",
+            bf_path, err_path);
+    return false;
+  }
+  return true;
+}
+
+// reads the times bf-jit --stats printed to err_path
+bool bench_parse_stats(const char *err_path, Bench_Result *run) {
+  NOB_String_Builder err = {0};
+  bool result = true;
+  if (!nob_read_entire_file(err_path, &err))
+    nob_return_defer(false);
+  nob_sb_append_null(&err);
+  const char *line = strstr(err.items, "stats:");
+  if (!line || sscanf(line, "stats: parse_ms=%lf compile_ms=%lf run_ms=%lf",
+                      &run->parse_ms, &run->compile_ms, &run->run_ms) != 3) {
+    nob_log(NOB_ERROR, "no stats in %s", err_path);
+    nob_return_defer(false);
+  }
+
+defer:
+  nob_sb_free(err);
+  return result;
+}
+
+bool bench_same_output(const char *out_path, const char *name) {
+  const char *expected_path = nob_temp_sprintf("./bench/%s.out", name);
+  NOB_String_Builder out = {0};
+  NOB_String_Builder expected = {0};
+  bool result = true;
+  if (!nob_read_entire_file(out_path, &out) ||
+      !nob_read_entire_file(expected_path, &expected))
+    nob_return_defer(false);
+  if (!nob_sv_eq(nob_sv_from_parts(out.items, out.count),
+                 nob_sv_from_parts(expected.items, expected.count))) {
+    nob_log(NOB_ERROR, "output of %s differs from %s", out_path,
+            expected_path);
+    nob_return_defer(false);
+  }
+
+defer:
+  nob_sb_free(out);
+  nob_sb_free(expected);
+  return result;
+}
+
+Bench_Result bench_one(const char *binary, const char *flag, const char *name,
+                       size_t runs) {
+  const char *out_path = "./build/bench.out";
+  const char *err_path = "./build/bench.err";
+  Bench_Result result = {.ok = true};
+  for (size_t i = 0; i < runs; i++) {
+    Bench_Result run = {0};
+    size_t checkpoint = nob_temp_save();
+    const char *bf_path = nob_temp_sprintf("./bench/%s.bf", name);
+    const char *in_path = nob_temp_sprintf("./bench/%s.in", name);
+    if (!nob_file_exists(in_path))
+      in_path = "/dev/null";
+    if (!bench_spawn(binary, flag, bf_path, in_path, out_path, err_path,
+                     &run.wall_ms, &run.max_rss_kb) ||
+        !bench_parse_stats(err_path, &run) ||
+        !bench_same_output(out_path, name)) {
+      nob_temp_rewind(checkpoint);
+      result.ok = false;
+      return result;
+    }
+    nob_temp_rewind(checkpoint);
+    if (i == 0 || run.parse_ms < result.parse_ms)
+      result.parse_ms = run.parse_ms;
+    if (i == 0 || run.compile_ms < result.compile_ms)
+      result.compile_ms = run.compile_ms;
+    if (i == 0 || run.run_ms < result.run_ms)
+      result.run_ms = run.run_ms;
+    if (i == 0 || run.wall_ms < result.wall_ms)
+      result.wall_ms = run.wall_ms;
+    if (run.max_rss_kb > result.max_rss_kb)
+      result.max_rss_kb = run.max_rss_kb;
+  }
+  return result;
+}
+
+// generated sources the parser is timed on. Each is a single loop that never
+// runs, so the time is all spent reading the source.
+static const struct {
+  const char *name;
+  const char *line;   // repeated until the source is PARSE_BENCH_SIZE bytes
+  size_t code_every;  // every nth line is code instead, 0 for never
+} parse_benchmarks[] = {
+    {"comments", "the quick brown fox jumps over the lazy dog, again\n", 16},
+    {"code", "++>-<[->+<]>>[-<<+>>]<<.\n", 0},
+};
+
+#define PARSE_BENCH_SIZE (64 * 1024 * 1024)
+#define PARSE_BENCH_CODE "+>[-<+>]<\n"
+
+bool parse_bench_generate(const char *path, size_t i) {
+  if (nob_file_exists(path))
+    return true;
+  NOB_String_Builder source = {0};
+  nob_sb_append_cstr(&source, "[\n");
+  for (size_t n = 0; source.count < PARSE_BENCH_SIZE; n++) {
+    if (parse_benchmarks[i].code_every &&
+        n % parse_benchmarks[i].code_every == 0)
+      nob_sb_append_cstr(&source, PARSE_BENCH_CODE);
+    else
+      nob_sb_append_cstr(&source, parse_benchmarks[i].line);
+  }
+  nob_sb_append_cstr(&source, "]\n");
+  bool result = nob_write_entire_file(path, source.items, source.count);
+  nob_sb_free(source);
+  return result;
+}
+
+// the fastest parse of the runs in MB/s, 0 when a run failed
+double parse_bench_one(const char *binary, size_t i, size_t runs) {
+  const char *bf_path =
+      nob_temp_sprintf("./build/parse-%s.bf", parse_benchmarks[i].name);
+  const char *out_path = "./build/bench.out";
+  const char *err_path = "./build/bench.err";
+  if (!parse_bench_generate(bf_path, i))
+    return 0;
+  struct stat st;
+  if (stat(bf_path, &st) < 0) {
+    nob_log(NOB_ERROR, "could not stat %s: %s", bf_path, strerror(errno));
+    return 0;
+  }
+
+  double parse_ms = 0;
+  for (size_t j = 0; j < runs; j++) {
+    Bench_Result run = {0};
+    if (!bench_spawn(binary, "-mi", bf_path, "/dev/null", out_path, err_path,
+                     &run.wall_ms, &run.max_rss_kb) ||
+        !bench_parse_stats(err_path, &run))
+      return 0;
+    if (j == 0 || run.parse_ms < parse_ms)
+      parse_ms = run.parse_ms;
+  }
+  return parse_ms > 0 ? st.st_size / 1e6 / (parse_ms / 1e3) : 0;
+}
+
+// runs every benchmark in every mode, prints a table of the results and
+// writes them to ./build/bench.json
+bool bench(const char *binary, size_t runs) {
+  bool result = true;
+  NOB_String_Builder json = {0};
+  nob_sb_append_cstr(&json, "{\n");
+  nob_sb_append_cstr(&json, nob_temp_sprintf("  \"runs\": %zu,\n", runs));
+  nob_sb_append_cstr(&json, "  \"results\": [");
+
+  printf("%-12s %-10s %10s %10s %10s %10s %10s  %s\n", "benchmark", "mode",
+         "parse ms", "compile ms", "run ms", "wall ms", "rss KiB", "output");
+  for (size_t i = 0; i < NOB_ARRAY_LEN(benchmarks); i++) {
+    for (size_t j = 0; j < NOB_ARRAY_LEN(bench_modes); j++) {
+      Bench_Result r = bench_one(binary, bench_modes[j].flag, benchmarks[i],
+                                 runs);
+      if (!r.ok)
+        result = false;
+      printf("%-12s %-10s %10.3f %10.3f %10.3f %10.3f %10ld  %s\n",
+             benchmarks[i], bench_modes[j].name, r.parse_ms, r.compile_ms,
+             r.run_ms, r.wall_ms, r.max_rss_kb, r.ok ? "ok" : "FAILED");
+      fflush(stdout);
+      nob_sb_append_cstr(
+          &json,
+          nob_temp_sprintf("%s\n    {\"benchmark\": \"%s\", \"mode\": \"%s\", "
+                           "\"parse_ms\": %.3f, \"compile_ms\": %.3f, "
+                           "\"run_ms\": %.3f, \"wall_ms\": %.3f, "
+                           "\"max_rss_kb\": %ld, \"ok\": %s}",
+                           i + j ? "," : "", benchmarks[i],
+                           bench_modes[j].name, r.parse_ms, r.compile_ms,
+                           r.run_ms, r.wall_ms, r.max_rss_kb,
+                           r.ok ? "true" : "false"));
+      nob_temp_reset();
+    }
+  }
+  nob_sb_append_cstr(&json, "\n  ],\n");
+
+  nob_sb_append_cstr(&json, "  \"parse\": [");
+  printf("\n%-12s %10s  %s\n", "parse", "MB/s", "output");
+  for (size_t i = 0; i < NOB_ARRAY_LEN(parse_benchmarks); i++) {
+    double mb_per_s = parse_bench_one(binary, i, runs);
+    if (mb_per_s == 0)
+      result = false;
+    printf("%-12s %10.1f  %s\n", parse_benchmarks[i].name, mb_per_s,
+           mb_per_s > 0 ? "ok" : "FAILED");
+    fflush(stdout);
+    nob_sb_append_cstr(
+        &json, nob_temp_sprintf("%s\n    {\"source\": \"%s\", "
+                                "\"mb_per_s\": %.1f, \"ok\": %s}",
+                                i ? "," : "", parse_benchmarks[i].name,
+                                mb_per_s, mb_per_s > 0 ? "true" : "false"));
+    nob_temp_reset();
+  }
+  nob_sb_append_cstr(&json, "\n  ]\n}\n");
+
+  const char *json_path = "./build/bench.json";
+  if (!nob_write_entire_file(json_path, json.items, json.count))
+    nob_return_defer(false);
+  nob_log(NOB_INFO, "wrote %s", json_path);
+
+defer:
+  nob_sb_free(json);
+  return result;
+}
+
 int main(int argc, char **argv) {
   GO_REBUILD_YOURSELF(argc, argv);
 
   const char *program = nob_shift_args(&argc, &argv);
-  (void)program;
 
   NOB_Cmd cmd = {0};
 
@@ -30,6 +305,26 @@ int main(int argc, char **argv) {
   if (!nob_cmd_run_sync(cmd))
     return EXIT_FAILURE;
 
+  if (argc > 0 && !strcmp(argv[0], "lib")) {
+    // everything but main, with only the functions of bf-jit.h exported
+    cmd.count = 0;
+    cc(&cmd);
+    nob_cmd_append(&cmd, "-shared", "-fPIC", "-fvisibility=hidden");
+    nob_cmd_append(&cmd, "-DBFJIT_LIBRARY");
+    nob_cmd_append(&cmd, "-o", "./build/libbf-jit.so");
+    nob_cmd_append(&cmd, main_input);
+    return nob_cmd_run_sync(cmd) ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+
+  if (argc > 0 && !strcmp(argv[0], "bench")) {
+    size_t runs = argc > 1 ? strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_RUNS;
+    if (runs == 0) {
+      nob_log(NOB_ERROR, "Usage: %s bench [runs]", program);
+      return EXIT_FAILURE;
+    }
+    return bench(main_output, runs) ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+
   cmd.count = 0;
   nob_cmd_append(&cmd, main_output);
   nob_da_append_many(&cmd, argv, argc);
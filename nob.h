@@ -541,6 +541,10 @@ char *nob_shift_args(int *argc, char ***argv) {
 }
 
 void nob_log(NOB_Log_Level level, const char *fmt, ...) {
+#ifndef _WIN32
+	// keep the line whole when other threads log at the same time
+	flockfile(stderr);
+#endif
 	switch (level) {
 	case NOB_INFO: {
 		fprintf(stderr, "[INFO] ");
@@ -560,6 +564,9 @@ void nob_log(NOB_Log_Level level, const char *fmt, ...) {
 	vfprintf(stderr, fmt, args);
 	va_end(args);
 	fprintf(stderr, NOB_LINE_END);
+#ifndef _WIN32
+	funlockfile(stderr);
+#endif
 }
 
 bool nob_read_entire_dir(const char *parent, NOB_File_Paths *children) {
@@ -587,7 +594,7 @@ defer:
 }
 
 bool nob_write_entire_file(const char *path, const void *data, size_t size) {
-	bool  result   = 0;
+	bool  result   = true;
 	FILE *out_file = fopen(path, "wb");
 	if (out_file == NULL) {
 		nob_log(NOB_ERROR, "could not open file %s for writing: %s", path, str_err_no);
@@ -0,0 +1,6 @@
+use64
+    cmp r10, -low
+    jb memory_error
+    lea rcx, [r10 + high]
+    cmp rcx, r8
+    jae memory_error
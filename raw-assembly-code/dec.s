@@ -1,3 +1,2 @@
 use64
-    mov rax, 1
-    sub byte[rdi], al
\ No newline at end of file
+    sub byte[rdi + offset], operand
@@ -0,0 +1,27 @@
+use64
+flush:
+    push rdi
+    mov rsi, [r9 + out_items]
+    mov rdx, [r9 + out_count]
+.loop:
+    test rdx, rdx
+    jz .done
+    mov edi, [r9 + out_fd]
+    mov eax, 1
+    syscall
+    test rax, rax
+    jle .fail
+    add rsi, rax
+    sub rdx, rax
+    jmp .loop
+.done:
+    mov qword[r9 + out_count], 0
+    xor eax, eax
+    pop rdi
+    ret
+.fail:
+    cmp rax, -EINTR
+    je .loop
+    mov eax, 2
+    pop rdi
+    ret
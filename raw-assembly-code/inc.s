@@ -1,3 +1,2 @@
 use64
-    mov rax, 1
-    add byte[rdi], al
\ No newline at end of file
+    add byte[rdi + offset], operand
@@ -1,8 +1,24 @@
 use64
-    push rdi
-    xor rax, rax
-    mov rsi, rdi
-    mov rdi, 1
-    mov rdx, 1
-    syscall
-    pop rdi
+    mov rax, [r9 + in_pos]
+    cmp rax, [r9 + in_count]
+    jb .have
+    call refill
+    cmp eax, 1
+    ja io_error
+    je .eof
+.have:
+    mov rcx, [r9 + in_items]
+    mov cl, byte[rcx + rax]
+    mov byte[rdi], cl
+    inc rax
+    mov [r9 + in_pos], rax
+    jmp .done
+.eof:
+    mov eax, [r9 + eof_mode]
+    test eax, eax
+    jz .done
+    cmp eax, EOF_ZERO
+    sete al
+    dec al
+    mov byte[rdi], al
+.done:
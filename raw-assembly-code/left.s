@@ -1,7 +1,4 @@
 use64
-    mov rax, operand
-    sub r10, rax
-    jns 8
-    mov rax, 1
-    ret
-    sub rdi, rax
+    sub r10, operand
+    jb memory_error
+    sub rdi, operand
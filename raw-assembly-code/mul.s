@@ -0,0 +1,10 @@
+use64
+    movzx eax, byte[rdi + source]
+    test al, al
+    jz .skip
+    lea rcx, [r10 + offset]
+    cmp rcx, r8
+    jae memory_error
+    imul eax, eax, operand
+    add byte[rdi + offset], al
+.skip:
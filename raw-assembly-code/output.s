@@ -1,8 +1,19 @@
 use64
+    mov rax, [r9 + out_count]
+    cmp rax, RUNTIME_BUFFER_CAPACITY - operand
+    jbe fits
+    call flush
+    test eax, eax
+    jnz io_error
+fits:
+    mov rcx, [r9 + out_items]
+    add rcx, rax
+    mov dl, byte[rdi]
+    add rax, operand
+    mov [r9 + out_count], rax
     push rdi
-    mov rax, 1
-    mov rsi, rdi
-    mov rdi, 1
-    mov rdx, 1
-    syscall
+    mov rdi, rcx
+    mov al, dl
+    mov ecx, operand
+    rep stosb
     pop rdi
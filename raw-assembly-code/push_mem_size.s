@@ -1,5 +1,6 @@
 use64
-    xor r10, r10
+    mov r9, rsi
+    mov r10, [r9 + head]
     mov r8, 10000
 
     
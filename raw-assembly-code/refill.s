@@ -0,0 +1,28 @@
+use64
+refill:
+    call flush
+    test eax, eax
+    jnz .ret
+    push rdi
+.again:
+    xor eax, eax
+    mov edi, [r9 + in_fd]
+    mov rsi, [r9 + in_items]
+    mov edx, RUNTIME_BUFFER_CAPACITY
+    syscall
+    cmp rax, -EINTR
+    je .again
+    mov qword[r9 + in_pos], 0
+    test rax, rax
+    jg .filled
+    xor eax, eax
+    mov [r9 + in_count], rax
+    mov eax, 1
+    pop rdi
+    ret
+.filled:
+    mov [r9 + in_count], rax
+    xor eax, eax
+    pop rdi
+.ret:
+    ret
@@ -1,8 +1,5 @@
 use64
-    mov rax, operand
-    add r10, rax
-    cmp r8, r10
-    jns 8
-    mov rax, 1
-    ret
-    add rdi, rax
+    add r10, operand
+    cmp r10, r8
+    jae memory_error
+    add rdi, operand
@@ -0,0 +1,27 @@
+use64
+    mov rcx, rdi
+    and ecx, 15
+    sub rdi, rcx
+    sub r10, rcx
+    mov edx, lanes
+    rol dx, cl
+    mov r11d, -2
+    shl r11d, cl
+    not r11d
+    and r11d, edx
+    pxor xmm1, xmm1
+.loop:
+    movdqa xmm0, [rdi]
+    pcmpeqb xmm0, xmm1
+    pmovmskb eax, xmm0
+    and eax, r11d
+    jnz .found
+    mov r11d, edx
+    sub rdi, 16
+    sub r10, 16
+    jmp .loop
+.found:
+    bsr eax, eax
+    add rdi, rax
+    add r10, rax
+    js memory_error
@@ -0,0 +1,27 @@
+use64
+    mov rcx, rdi
+    and ecx, 15
+    sub rdi, rcx
+    sub r10, rcx
+    mov edx, lanes
+    rol dx, cl
+    mov r11d, -1
+    shl r11d, cl
+    and r11d, edx
+    pxor xmm1, xmm1
+.loop:
+    movdqa xmm0, [rdi]
+    pcmpeqb xmm0, xmm1
+    pmovmskb eax, xmm0
+    and eax, r11d
+    jnz .found
+    mov r11d, edx
+    add rdi, 16
+    add r10, 16
+    jmp .loop
+.found:
+    bsf eax, eax
+    add rdi, rax
+    add r10, rax
+    cmp r10, r8
+    jae memory_error
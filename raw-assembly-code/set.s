@@ -0,0 +1,2 @@
+use64
+    mov byte[rdi + offset], operand
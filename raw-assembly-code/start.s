@@ -0,0 +1,60 @@
+use64
+_start:
+    mov rsi, runtime
+    mov rax, out_buffer
+    mov [rsi + out_items], rax
+    mov rax, in_buffer
+    mov [rsi + in_items], rax
+    mov dword[rsi + out_fd], 1
+    mov dword[rsi + eof_mode], eof_mode
+    mov rdi, tape
+    call code
+    mov ebx, eax
+    test eax, eax
+    jz .exit
+    cmp eax, 2
+    je .message
+    mov r9, runtime
+    mov rsi, [r9 + out_items]
+    mov rdx, [r9 + out_count]
+.flush:
+    test rdx, rdx
+    jz .message
+    mov edi, 1
+    mov eax, 1
+    syscall
+    cmp rax, -EINTR
+    je .flush
+    test rax, rax
+    jle .message
+    add rsi, rax
+    sub rdx, rax
+    jmp .flush
+.message:
+    cmp ebx, 1
+    jne .overflow
+    mov rsi, underflow_message
+    mov edx, underflow_message_length
+    jmp .write
+.overflow:
+    cmp ebx, 3
+    jne .io_error
+    mov rsi, overflow_message
+    mov edx, overflow_message_length
+    jmp .write
+.io_error:
+    cmp ebx, 2
+    jne .none
+    mov rsi, io_error_message
+    mov edx, io_error_message_length
+    jmp .write
+.none:
+    jmp .exit
+.write:
+    mov edi, 2
+    mov eax, 1
+    syscall
+.exit:
+    mov edi, ebx
+    mov eax, 231
+    syscall